@@ -0,0 +1,96 @@
+/*****************************************************************//**
+ * \file	ClassifyBench.cpp
+ * \brief	Benchmark of classifyMessage against the branchy validity checks.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ * 
+ * Build this file with every .cpp file in src and JuceHeader.h on the include path,
+ * with optimizations on, then run it. The exit code is non-zero if the two classifiers disagree.
+ *********************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "../src/MackieControl.h"
+
+using namespace mackieControl;
+
+/** Classification by status branches and linear searches of the valid value lists, as before the lookup tables. */
+static MessageType classifyBranchy(uint8_t status, uint8_t data1, uint8_t data2) {
+	auto contains = [](const auto& list, uint8_t value) {
+		return std::find_if(list.begin(), list.end(),
+			[value](auto item) { return static_cast<int>(item) == value; }) != list.end();
+	};
+
+	if (status == 0xF0) {
+		return contains(validSysExMessage, data1) ? MessageType::SysEx : MessageType::Invalid;
+	}
+	if ((status & 0xF0) == 0x80 || (status & 0xF0) == 0x90) {
+		return (contains(validNoteMessage, data1) && contains(validVelocityMessage, data2))
+			? MessageType::Note : MessageType::Invalid;
+	}
+	if ((status & 0xF0) == 0xB0) {
+		return contains(validCCMessage, data1) ? MessageType::CC : MessageType::Invalid;
+	}
+	if ((status & 0xF0) == 0xD0) {
+		return MessageType::ChannelPressure;
+	}
+	if ((status & 0xF0) == 0xE0 && (status & 0x0F) < 9) {
+		return MessageType::PitchWheel;
+	}
+	return MessageType::Invalid;
+}
+
+/** Run the classifier over the input repeatedly and return nanoseconds per message. */
+template <typename Classifier>
+static double measure(const std::vector<std::array<uint8_t, 3>>& input, int passes, Classifier&& classifier, uint64_t& sink) {
+	auto start = std::chrono::steady_clock::now();
+	for (int pass = 0; pass < passes; pass++) {
+		for (auto& bytes : input) {
+			sink += static_cast<uint64_t>(classifier(bytes[0], bytes[1], bytes[2]));
+		}
+	}
+	auto end = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::nano>(end - start).count() / (static_cast<double>(input.size()) * passes);
+}
+
+int main() {
+	// Both classifiers must agree on every status and first data byte
+	int mismatches = 0;
+	for (int status = 0; status < 256; status++) {
+		for (int data1 = 0; data1 < 256; data1++) {
+			for (int data2 : { 0, 1, 2, 64, 127, 128, 255 }) {
+				auto s = static_cast<uint8_t>(status), d1 = static_cast<uint8_t>(data1), d2 = static_cast<uint8_t>(data2);
+				if (classifyMessage(s, d1, d2) != classifyBranchy(s, d1, d2)) { mismatches++; }
+			}
+		}
+	}
+
+	// Typical surface traffic: mostly notes, CCs and faders, some SysEx and noise
+	std::mt19937 random{ 42 };
+	std::vector<std::array<uint8_t, 3>> input(1 << 16);
+	for (auto& bytes : input) {
+		static constexpr std::array<uint8_t, 6> statuses = { 0x90, 0x90, 0xB0, 0xE0, 0xD0, 0xF0 };
+		bytes[0] = statuses[random() % statuses.size()] | ((random() % 4 == 0) ? (random() % 9) : 0);
+		if (bytes[0] == 0xF0 || bytes[0] > 0xF0) { bytes[0] = 0xF0; }
+		bytes[1] = static_cast<uint8_t>(random() % 128);
+		bytes[2] = static_cast<uint8_t>((random() % 2) ? 127 : random() % 128);
+	}
+
+	constexpr int passes = 200;
+	uint64_t sink = 0;
+	double branchy = measure(input, passes, classifyBranchy, sink);
+	double table = measure(input, passes,
+		[](uint8_t status, uint8_t data1, uint8_t data2) { return classifyMessage(status, data1, data2); }, sink);
+
+	std::printf("branchy: %.2f ns/message\n", branchy);
+	std::printf("table:   %.2f ns/message (%.1fx)\n", table, branchy / table);
+	std::printf("mismatches: %d (sink %llu)\n", mismatches, static_cast<unsigned long long>(sink));
+	return (mismatches == 0) ? 0 : 1;
+}
@@ -0,0 +1,194 @@
+/*****************************************************************//**
+ * \file	LCDFrameBufferBench.cpp
+ * \brief	Benchmark of bytes saved by the LCD frame buffer against full line resends.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ * 
+ * Build this file with every .cpp file in src and JuceHeader.h on the include path,
+ * then run it. The exit code is non-zero if the surface image differs from the wanted text.
+ *********************************************************************/
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../src/LCDFrameBuffer.h"
+#include "../src/MessageView.h"
+
+using namespace mackieControl;
+
+/** Characters of each channel strip cell on the LCD. */
+constexpr int cellSize = LCDFrameBuffer::lineSize / 8;
+
+/** LCD as seen by the surface, built only from the sent LCD messages. */
+struct Surface final {
+	std::array<char, LCDFrameBuffer::size> image;
+	uint64_t numBytes = 0;
+	bool valid = true;
+
+	Surface() {
+		// No character is known before the first message
+		this->image.fill('\0');
+	}
+
+	bool write(const uint8_t* data, int size) {
+		MessageView message{ data, size };
+		if (!message.isSysEx() || std::get<0>(message.getSysExData()) != SysExMessage::LCD) {
+			this->valid = false;
+			return false;
+		}
+
+		auto [place, text, count] = message.getLCDData();
+		if (place + count > LCDFrameBuffer::size) {
+			this->valid = false;
+			return false;
+		}
+		std::copy(text, text + count, &(this->image[place]));
+
+		this->numBytes += size;
+		return true;
+	}
+};
+
+struct Result final {
+	uint64_t sent = 0, lineResend = 0;
+	bool matched = true;
+};
+
+/**
+ * Apply each step to the frame buffer and flush it into the surface.
+ * The baseline resends each line which differs from the surface image.
+ */
+template <typename Step>
+static Result run(const LCDCostModel& model, int numSteps, Step&& step) {
+	LCDFrameBuffer lcd{ model };
+	Surface surface;
+	std::array<char, LCDFrameBuffer::size> wanted;
+	wanted.fill(' ');
+
+	Result result;
+	for (int i = 0; i < numSteps; i++) {
+		step(i, wanted);
+		lcd.setText(0, wanted.data(), LCDFrameBuffer::size);
+
+		for (int line = 0; line < 2; line++) {
+			auto begin = line * LCDFrameBuffer::lineSize;
+			if (!std::equal(&wanted[begin], &wanted[begin] + LCDFrameBuffer::lineSize, &(surface.image[begin]))) {
+				result.lineResend += Message::getLCDSize(LCDFrameBuffer::lineSize);
+			}
+		}
+
+		lcd.flushTo([&surface](const uint8_t* data, int size) { return surface.write(data, size); });
+		if (!surface.valid || lcd.isDirty() || surface.image != wanted) {
+			result.matched = false;
+		}
+	}
+
+	auto [text, size] = lcd.getText();
+	if (size != LCDFrameBuffer::size || !std::equal(text, text + size, wanted.data())) {
+		result.matched = false;
+	}
+	if (lcd.getNumBytesSent() != surface.numBytes) {
+		result.matched = false;
+	}
+
+	result.sent = surface.numBytes;
+	return result;
+}
+
+/** Write a string into a channel strip cell, padded with spaces. */
+static void setCell(std::array<char, LCDFrameBuffer::size>& wanted, bool lowerLine, int strip, const std::string& str) {
+	char* cell = &wanted[Message::toLCDPlace(lowerLine, static_cast<uint8_t>(strip * cellSize))];
+	for (int i = 0; i < cellSize; i++) {
+		cell[i] = (i < static_cast<int>(str.size())) ? str[i] : ' ';
+	}
+}
+
+int main() {
+	constexpr int numTracks = 64;
+	constexpr int numSteps = 2000;
+
+	// 7-character track names share prefixes like real sessions, so banks differ in a few characters of each cell
+	const char* prefixes[] = { "Kick", "Snar", "Tom", "OH", "Bass", "Gtr", "Keys", "Vox" };
+	std::vector<std::string> names;
+	for (int i = 0; i < numTracks; i++) {
+		char name[16];
+		std::snprintf(name, sizeof(name), "%-4s %02d", prefixes[i % 8], i / 8 + 1);
+		names.push_back(name);
+	}
+
+	struct Model final {
+		const char* name;
+		LCDCostModel model;
+	};
+	std::vector<Model> models;
+	models.push_back({ "default", LCDCostModel{} });
+	{
+		LCDCostModel model;
+		model.crossLines = false;
+		models.push_back({ "no cross lines", model });
+	}
+	{
+		LCDCostModel model;
+		model.messageOverhead = Message::getLCDSize(0) * 4;
+		models.push_back({ "4x overhead", model });
+	}
+
+	/** Bank switches by one or eight tracks, with the level of each strip below its name. */
+	auto bankSwitch = [&names](int step, std::array<char, LCDFrameBuffer::size>& wanted) {
+		std::mt19937 random{ static_cast<std::mt19937::result_type>(step) };
+		int bank = static_cast<int>(random() % (numTracks - 7));
+		if (step % 2 == 0) { bank -= bank % 8; }
+
+		for (int strip = 0; strip < 8; strip++) {
+			setCell(wanted, false, strip, names[bank + strip]);
+			setCell(wanted, true, strip, ((bank + strip) % 3 == 0) ? "  0.0" : " -inf");
+		}
+	};
+
+	/** Ticking dB readouts, one strip changes each step while the names stay put. */
+	std::array<double, 8> levels{};
+	auto parameterTick = [&names, &levels](int step, std::array<char, LCDFrameBuffer::size>& wanted) {
+		if (step == 0) {
+			levels.fill(-12.0);
+			for (int strip = 0; strip < 8; strip++) {
+				setCell(wanted, false, strip, names[strip]);
+			}
+		}
+
+		std::mt19937 random{ static_cast<std::mt19937::result_type>(step) };
+		int strip = static_cast<int>(random() % 8);
+		levels[strip] = std::clamp(levels[strip] + ((random() % 2) ? 0.1 : -0.1) * (1 + random() % 10), -60.0, 6.0);
+
+		for (int i = 0; i < 8; i++) {
+			char value[16];
+			std::snprintf(value, sizeof(value), "%5.1f", levels[i]);
+			setCell(wanted, true, i, value);
+		}
+	};
+
+	bool matched = true;
+	auto report = [&matched](const char* workload, const char* model, const Result& result) {
+		long long saved = static_cast<long long>(result.lineResend) - static_cast<long long>(result.sent);
+		double ratio = (result.lineResend > 0) ? (100.0 * saved / result.lineResend) : 0.0;
+		std::printf("%-16s %-16s sent %7llu bytes, line resend %7llu bytes, saved %7lld bytes (%5.1f%%)%s\n",
+			workload, model, static_cast<unsigned long long>(result.sent),
+			static_cast<unsigned long long>(result.lineResend), saved, ratio, result.matched ? "" : " MISMATCH");
+		matched = matched && result.matched;
+	};
+
+	for (auto& model : models) {
+		report("track names", model.name, run(model.model, numSteps, bankSwitch));
+	}
+	for (auto& model : models) {
+		report("parameter values", model.name, run(model.model, numSteps, parameterTick));
+	}
+
+	std::printf("%s\n", matched ? "Surface image matched" : "Surface image mismatched");
+	return matched ? 0 : 1;
+}
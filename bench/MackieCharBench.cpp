@@ -0,0 +1,108 @@
+/*****************************************************************//**
+ * \file	MackieCharBench.cpp
+ * \brief	Benchmark of bulk Mackie character conversion against per-character branches.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ * 
+ * Build this file with every .cpp file in src and JuceHeader.h on the include path,
+ * with optimizations on, then run it. The exit code is non-zero if the conversions disagree.
+ *********************************************************************/
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "../src/MackieChar.h"
+
+using namespace mackieControl;
+
+/** Per-character conversion as before the lookup tables. */
+static uint8_t charToMackieBranchy(char c) {
+	if (c >= 'a' && c <= 'z') { return (c - 'a') + 1; }
+	else if (c >= 'A' && c <= 'Z') { return (c - 'A') + 1; }
+	else if (c >= '0' && c <= '9') { return c; }
+
+	return ' ';
+}
+
+/** Per-character conversion as before the lookup tables. */
+static char mackieToCharBranchy(uint8_t c) {
+	if ((c - 1) >= 0 && (c - 1) <= 'Z' - 'A') { return 'A' + (c - 1); }
+	else if (c >= '0' && c <= '9') { return c; }
+
+	return ' ';
+}
+
+/** Run the conversion over the input repeatedly and return nanoseconds per character. */
+template <typename Converter>
+static double measure(int size, int passes, Converter&& converter) {
+	auto start = std::chrono::steady_clock::now();
+	for (int pass = 0; pass < passes; pass++) {
+		converter();
+	}
+	auto end = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::nano>(end - start).count() / (static_cast<double>(size) * passes);
+}
+
+int main() {
+	// A full LCD of channel names is 112 characters, so measure on LCD-sized blocks
+	constexpr int size = 112;
+	constexpr int passes = 200000;
+
+	std::mt19937 random{ 42 };
+	std::vector<char> text(size);
+	for (auto& c : text) {
+		c = static_cast<char>(random() % 128);
+	}
+
+	std::vector<uint8_t> branchyCodes(size), bulkCodes(size);
+	std::vector<char> branchyText(size), bulkText(size);
+	unsigned sink = 0;
+
+	double branchyToMackie = measure(size, passes, [&] {
+		for (int i = 0; i < size; i++) {
+			branchyCodes[i] = charToMackieBranchy(text[i]);
+		}
+		sink += static_cast<uint8_t>(branchyCodes[sink % size]);
+		});
+	double bulkToMackie = measure(size, passes, [&] {
+		toMackie(text, bulkCodes);
+		sink += static_cast<uint8_t>(bulkCodes[sink % size]);
+		});
+	double branchyToChar = measure(size, passes, [&] {
+		for (int i = 0; i < size; i++) {
+			branchyText[i] = mackieToCharBranchy(branchyCodes[i]);
+		}
+		sink += static_cast<uint8_t>(branchyText[sink % size]);
+		});
+	double bulkToChar = measure(size, passes, [&] {
+		toChar(bulkCodes, bulkText);
+		sink += static_cast<uint8_t>(bulkText[sink % size]);
+		});
+
+	// Every byte value must convert the same way
+	int mismatches = 0;
+	for (int i = 0; i < 256; i++) {
+		char c = static_cast<char>(i);
+		uint8_t code = 0;
+		toMackie(std::span<const char>{ &c, 1 }, std::span<uint8_t>{ &code, 1 });
+		if (code != charToMackieBranchy(c)) { mismatches++; }
+
+		uint8_t m = static_cast<uint8_t>(i);
+		char back = 0;
+		toChar(std::span<const uint8_t>{ &m, 1 }, std::span<char>{ &back, 1 });
+		if (back != mackieToCharBranchy(m)) { mismatches++; }
+	}
+	if (branchyCodes != bulkCodes || branchyText != bulkText) { mismatches++; }
+
+	std::printf("to Mackie: branchy %.3f ns/char, bulk %.3f ns/char (%.1fx)\n",
+		branchyToMackie, bulkToMackie, branchyToMackie / bulkToMackie);
+	std::printf("to char:   branchy %.3f ns/char, bulk %.3f ns/char (%.1fx)\n",
+		branchyToChar, bulkToChar, branchyToChar / bulkToChar);
+	std::printf("mismatches: %d (sink %u)\n", mismatches, sink);
+	return (mismatches == 0) ? 0 : 1;
+}
@@ -0,0 +1,98 @@
+/*****************************************************************//**
+ * \file	SessionHostBench.cpp
+ * \brief	Scaling measurement of SessionHost from 1 to 64 sessions.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ * 
+ * Build this file with every .cpp file in src and JuceHeader.h on the include path,
+ * with optimizations on, then run it. The exit code is non-zero if any event is lost.
+ *********************************************************************/
+
+#include <cstdio>
+#include <thread>
+
+#include "../src/SessionHost.h"
+
+using namespace mackieControl;
+
+/** Session which only counts its events, so the measurement is the cost of the host. */
+class CountingSession final : public SurfaceSession {
+public:
+	void handleInput(const InboundEvent&, const MessageView&) override {
+		this->numEvents++;
+	}
+
+private:
+	uint64_t numEvents = 0;
+};
+
+struct Result final {
+	double eventsPerSecond = 0;
+	double meanLatency = 0, maxLatency = 0;
+	bool complete = false;
+};
+
+/**
+ * Push events into the first numActive of numSessions sessions from one producer thread and wait until all are handled.
+ */
+static Result run(int numWorkers, int numSessions, int numActive, int numEvents) {
+	SessionHost host{ numWorkers };
+	for (int i = 0; i < numSessions; i++) {
+		host.addSession(std::make_unique<CountingSession>());
+	}
+	host.start();
+
+	const uint8_t fader[3] = { 0xE0, 0x00, 0x40 };
+	MessageView message{ fader, sizeof(fader) };
+
+	double startTime = SessionHost::getCurrentTime();
+	for (int i = 0; i < numEvents; i++) {
+		int session = i % numActive;
+		while (!host.push(session, message)) {
+			std::this_thread::yield();
+		}
+	}
+
+	// Give up after a few seconds, a lost wake-up would hang here forever
+	double deadline = SessionHost::getCurrentTime() + 5;
+	while (host.getNumHandled() < static_cast<uint64_t>(numEvents) && SessionHost::getCurrentTime() < deadline) {
+		std::this_thread::yield();
+	}
+	double endTime = SessionHost::getCurrentTime();
+	host.stop();
+
+	Result result;
+	result.complete = (host.getNumHandled() == static_cast<uint64_t>(numEvents));
+	result.eventsPerSecond = numEvents / (endTime - startTime);
+	for (int i = 0; i < numActive; i++) {
+		auto [count, mean, max] = host.getLatency(i);
+		result.meanLatency += mean * count / numEvents;
+		result.maxLatency = std::max(result.maxLatency, max);
+	}
+	return result;
+}
+
+int main() {
+	constexpr int numWorkers = 4;
+	constexpr int numEvents = 1 << 18;
+
+	bool complete = true;
+	std::printf("%d workers, %d events per run\n", numWorkers, numEvents);
+	std::printf("sessions  active  events/s     mean latency  max latency\n");
+	for (int numSessions = 1; numSessions <= 64; numSessions *= 2) {
+		// All sessions busy, then one busy session among idle ones
+		for (int numActive : { numSessions, 1 }) {
+			auto result = run(numWorkers, numSessions, numActive, numEvents);
+			complete &= result.complete;
+			std::printf("%8d  %6d  %11.0f  %9.1f us  %9.1f us%s\n", numSessions, numActive, result.eventsPerSecond,
+				result.meanLatency * 1e6, result.maxLatency * 1e6, result.complete ? "" : "  (events lost)");
+
+			if (numSessions == 1) { break; }
+		}
+	}
+
+	return complete ? 0 : 1;
+}
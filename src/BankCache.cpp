@@ -0,0 +1,199 @@
+/*****************************************************************//**
+ * \file	BankCache.cpp
+ * \brief	Pre-serialized strip frames of adjacent banks for instant bank switches.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ *********************************************************************/
+
+#include "BankCache.h"
+
+namespace mackieControl {
+	/** Offset of the LCD characters in a frame. */
+	constexpr int lcdTextOffset = 1 + 5 + 1;
+	/** Offset of the V-Pot LED ring messages in a frame. */
+	constexpr int ringOffset = BankCache::lcdSize;
+	/** Offset of the LED messages in a frame, ordered by LED row and then by strip like the notes. */
+	constexpr int ledOffset = ringOffset + BankCache::stripsPerBank * 3;
+	/** Offset of the fader messages in a frame. */
+	constexpr int faderOffset = ledOffset + BankCache::stripsPerBank * 4 * 3;
+
+	static_assert(faderOffset + BankCache::stripsPerBank * 3 == BankCache::frameSize);
+
+	BankCache::BankCache(int numTracks, int numFrames) {
+		this->frames.resize(std::max(numFrames, 1));
+		this->setNumTracks(numTracks);
+	}
+
+	void BankCache::setNumTracks(int numTracks) {
+		Track blank;
+		blank.text.fill(' ');
+		this->tracks.resize(std::max(numTracks, 0), blank);
+		this->invalidate();
+	}
+
+	int BankCache::getNumTracks() const {
+		return static_cast<int>(this->tracks.size());
+	}
+
+	void BankCache::invalidate() {
+		for (auto& frame : this->frames) {
+			frame.firstTrack = -1;
+			frame.lastUsed = 0;
+		}
+	}
+
+	void BankCache::setName(int track, std::span<const char> text) {
+		this->setText(track, 0, text);
+	}
+
+	void BankCache::setValueText(int track, std::span<const char> text) {
+		this->setText(track, 1, text);
+	}
+
+	void BankCache::setVPotLEDRing(int track, int value) {
+		if (track < 0 || track >= this->getNumTracks()) { return; }
+
+		uint8_t ring = static_cast<uint8_t>(value & 0x7F);
+		this->tracks[track].ring = ring;
+		this->patch(track, [ring](uint8_t* bytes, int strip) {
+			bytes[ringOffset + strip * 3 + 2] = ring;
+			});
+	}
+
+	void BankCache::setLED(int track, StripLED led, VelocityMessage velocity) {
+		if (track < 0 || track >= this->getNumTracks()) { return; }
+
+		int row = static_cast<int>(led);
+		uint8_t value = static_cast<uint8_t>(velocity);
+		this->tracks[track].leds[row] = value;
+		this->patch(track, [row, value](uint8_t* bytes, int strip) {
+			bytes[ledOffset + (row * stripsPerBank + strip) * 3 + 2] = value;
+			});
+	}
+
+	void BankCache::setFader(int track, int value) {
+		if (track < 0 || track >= this->getNumTracks()) { return; }
+
+		uint16_t fader = static_cast<uint16_t>(juce::jlimit(0, 16383, value));
+		this->tracks[track].fader = fader;
+		this->patch(track, [fader](uint8_t* bytes, int strip) {
+			bytes[faderOffset + strip * 3 + 1] = static_cast<uint8_t>(fader & 0x7F);
+			bytes[faderOffset + strip * 3 + 2] = static_cast<uint8_t>(fader >> 7);
+			});
+	}
+
+	std::span<const uint8_t> BankCache::getFrame(int firstTrack) {
+		return this->findFrame(firstTrack, false).bytes;
+	}
+
+	int BankCache::addFrame(int firstTrack, juce::MidiBuffer& buffer, int samplePosition) {
+		auto& bytes = this->findFrame(firstTrack, false).bytes;
+
+		// The frame is one LCD message followed by 3-byte short messages
+		if (!buffer.addEvent(bytes.data(), lcdSize, samplePosition)) { return 0; }
+		int used = lcdSize;
+		for (; used < frameSize; used += 3) {
+			if (!buffer.addEvent(&bytes[used], 3, samplePosition)) { break; }
+		}
+		return used;
+	}
+
+	void BankCache::prefetch(int firstTrack) {
+		firstTrack = this->clampFirstTrack(firstTrack);
+		for (int offset : { 1, -1, stripsPerBank, -stripsPerBank }) {
+			this->findFrame(firstTrack + offset, true);
+		}
+	}
+
+	uint64_t BankCache::getNumHits() const {
+		return this->numHits;
+	}
+
+	uint64_t BankCache::getNumMisses() const {
+		return this->numMisses;
+	}
+
+	int BankCache::clampFirstTrack(int firstTrack) const {
+		return juce::jlimit(0, std::max(this->getNumTracks() - 1, 0), firstTrack);
+	}
+
+	BankCache::Frame& BankCache::findFrame(int firstTrack, bool prefetching) {
+		firstTrack = this->clampFirstTrack(firstTrack);
+
+		// Frames are few, so a linear scan is cheaper than any index
+		Frame* oldest = &(this->frames.front());
+		for (auto& frame : this->frames) {
+			if (frame.firstTrack == firstTrack) {
+				frame.lastUsed = ++(this->useCount);
+				if (!prefetching) { this->numHits++; }
+				return frame;
+			}
+			if (frame.lastUsed < oldest->lastUsed) { oldest = &frame; }
+		}
+
+		auto& frame = *oldest;
+		std::array<char, stripsPerBank * cellSize * 2> blank;
+		blank.fill(' ');
+		Message::writeLCD(frame.bytes, Message::toLCDPlace(false, 0), blank.data(), static_cast<int>(blank.size()));
+		for (int i = 0; i < stripsPerBank; i++) {
+			this->writeStrip(frame.bytes, i, firstTrack + i);
+		}
+
+		frame.firstTrack = firstTrack;
+		frame.lastUsed = ++(this->useCount);
+		if (!prefetching) { this->numMisses++; }
+		return frame;
+	}
+
+	void BankCache::writeStrip(std::span<uint8_t> bytes, int strip, int track) const {
+		Track blank;
+		blank.text.fill(' ');
+		auto& state = (track >= 0 && track < this->getNumTracks()) ? this->tracks[track] : blank;
+
+		std::memcpy(&bytes[lcdTextOffset + strip * cellSize], &state.text[0], cellSize);
+		std::memcpy(&bytes[lcdTextOffset + stripsPerBank * cellSize + strip * cellSize], &state.text[cellSize], cellSize);
+
+		uint8_t* ring = &bytes[ringOffset + strip * 3];
+		ring[0] = 0xB0;
+		ring[1] = static_cast<uint8_t>(static_cast<int>(CCMessage::VPotLEDRing1) + strip);
+		ring[2] = state.ring;
+
+		for (int row = 0; row < static_cast<int>(state.leds.size()); row++) {
+			uint8_t* led = &bytes[ledOffset + (row * stripsPerBank + strip) * 3];
+			led[0] = 0x90;
+			led[1] = static_cast<uint8_t>(static_cast<int>(NoteMessage::RECRDYCh1) + row * stripsPerBank + strip);
+			led[2] = state.leds[row];
+		}
+
+		uint8_t* fader = &bytes[faderOffset + strip * 3];
+		fader[0] = static_cast<uint8_t>(0xE0 | strip);
+		fader[1] = static_cast<uint8_t>(state.fader & 0x7F);
+		fader[2] = static_cast<uint8_t>(state.fader >> 7);
+	}
+
+	void BankCache::setText(int track, int line, std::span<const char> text) {
+		if (track < 0 || track >= this->getNumTracks()) { return; }
+
+		std::array<char, cellSize> cell;
+		cell.fill(' ');
+		std::copy_n(text.begin(), std::min<size_t>(text.size(), cell.size()), cell.begin());
+		std::copy(cell.begin(), cell.end(), this->tracks[track].text.begin() + line * cellSize);
+
+		this->patch(track, [&cell, line](uint8_t* bytes, int strip) {
+			std::memcpy(&bytes[lcdTextOffset + line * stripsPerBank * cellSize + strip * cellSize], cell.data(), cellSize);
+			});
+	}
+
+	template <typename Patcher>
+	void BankCache::patch(int track, Patcher&& patcher) {
+		for (auto& frame : this->frames) {
+			int strip = track - frame.firstTrack;
+			if (frame.firstTrack < 0 || strip < 0 || strip >= stripsPerBank) { continue; }
+
+			patcher(frame.bytes.data(), strip);
+		}
+	}
+}
@@ -0,0 +1,154 @@
+﻿/*****************************************************************//**
+ * \file	BankCache.h
+ * \brief	Pre-serialized strip frames of adjacent banks for instant bank switches.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ *********************************************************************/
+
+#pragma once
+
+#include "MackieControl.h"
+
+namespace mackieControl {
+	/**
+	 * LED row of a strip.
+	 */
+	enum class MACKIE_API StripLED {
+		RecReady,
+		Solo,
+		Mute,
+		Select
+	};
+
+	/**
+	 * Maps the tracks of a host onto pages of 8 strips and keeps the whole-surface frames of a few pages pre-serialized.
+	 * A frame holds the LCD, V-Pot LED rings, strip LEDs and faders of one page as raw MIDI bytes at fixed offsets,
+	 * so a track change patches the few bytes it owns in every cached frame and a bank switch sends one ready block.
+	 * Pages start at any track, so both bank (8 tracks) and channel (1 track) switches can hit the cache.
+	 */
+	class MACKIE_API BankCache final {
+	public:
+		/** Count of strips of a page. */
+		static constexpr int stripsPerBank = 8;
+		/** Count of LCD characters of each strip on each line. */
+		static constexpr int cellSize = 7;
+		/** Raw size of the LCD message of a frame. */
+		static constexpr int lcdSize = Message::getLCDSize(stripsPerBank * cellSize * 2);
+		/** Raw size of a frame. */
+		static constexpr int frameSize = lcdSize + (stripsPerBank + stripsPerBank * 4 + stripsPerBank) * 3;
+
+		/**
+		 * Create a bank cache.
+		 * \param numTracks		Count of tracks of the host
+		 * \param numFrames		Count of cached frames, enough for the current page and its neighbours
+		 */
+		explicit BankCache(int numTracks = 0, int numFrames = 5);
+
+		/**
+		 * Set the count of tracks of the host. All cached frames are dropped.
+		 */
+		void setNumTracks(int numTracks);
+		/**
+		 * Get the count of tracks of the host.
+		 */
+		int getNumTracks() const;
+		/**
+		 * Drop all cached frames.
+		 */
+		void invalidate();
+
+		/**
+		 * Set the name of a track shown on the upper LCD line.
+		 * \param track			Track Index
+		 * \param text			ASCII Characters, cut off or padded with spaces to 7 characters
+		 */
+		void setName(int track, std::span<const char> text);
+		/**
+		 * Set the text of a track shown on the lower LCD line.
+		 * \param track			Track Index
+		 * \param text			ASCII Characters, cut off or padded with spaces to 7 characters
+		 */
+		void setValueText(int track, std::span<const char> text);
+		/**
+		 * Set the V-Pot LED ring of a track.
+		 * \param track			Track Index
+		 * \param value			V-Pot LED Ring Value (Message::toVPotLEDRingValue)
+		 */
+		void setVPotLEDRing(int track, int value);
+		/**
+		 * Set an LED of a track.
+		 * \param track			Track Index
+		 * \param led			LED Row
+		 * \param velocity		LED State
+		 */
+		void setLED(int track, StripLED led, VelocityMessage velocity);
+		/**
+		 * Set the fader of a track.
+		 * \param track			Track Index
+		 * \param value			Fader Value (0-16383)
+		 */
+		void setFader(int track, int value);
+
+		/**
+		 * Get the frame of a page, serializing it if it isn't cached.
+		 * Tracks past the last track are blank.
+		 * \param firstTrack	Track Index of the first strip
+		 * \return	Raw MIDI bytes of the frame, valid until the next call of a non-const function
+		 */
+		std::span<const uint8_t> getFrame(int firstTrack);
+		/**
+		 * Append the messages of the frame of a page to the MIDI buffer.
+		 * \param firstTrack	Track Index of the first strip
+		 * \param buffer		MIDI Buffer
+		 * \param samplePosition	Sample Position
+		 * \return	Count of bytes emitted
+		 */
+		int addFrame(int firstTrack, juce::MidiBuffer& buffer, int samplePosition = 0);
+		/**
+		 * Serialize the frames of the pages one bank or one channel away from a page.
+		 * Called after the frame of a bank switch has been sent, so the next switch is a cache hit.
+		 * \param firstTrack	Track Index of the first strip
+		 */
+		void prefetch(int firstTrack);
+
+		/**
+		 * Get the count of frames served from the cache.
+		 */
+		uint64_t getNumHits() const;
+		/**
+		 * Get the count of frames serialized on demand.
+		 */
+		uint64_t getNumMisses() const;
+
+	private:
+		struct Track final {
+			std::array<char, cellSize * 2> text;
+			uint8_t ring = 0;
+			std::array<uint8_t, 4> leds{};
+			uint16_t fader = 0;
+		};
+		struct Frame final {
+			int firstTrack = -1;
+			uint64_t lastUsed = 0;
+			std::array<uint8_t, frameSize> bytes{};
+		};
+
+		std::vector<Track> tracks;
+		std::vector<Frame> frames;
+		uint64_t useCount = 0;
+		uint64_t numHits = 0, numMisses = 0;
+
+		int clampFirstTrack(int firstTrack) const;
+		Frame& findFrame(int firstTrack, bool prefetching);
+		void writeStrip(std::span<uint8_t> bytes, int strip, int track) const;
+		void setText(int track, int line, std::span<const char> text);
+
+		template <typename Patcher>
+		void patch(int track, Patcher&& patcher);
+
+		JUCE_LEAK_DETECTOR(BankCache)
+	};
+}
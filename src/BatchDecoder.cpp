@@ -0,0 +1,131 @@
+/*****************************************************************//**
+ * \file	BatchDecoder.cpp
+ * \brief	Decode a whole MIDI buffer into per-kind Mackie Control event columns.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ *********************************************************************/
+
+#include "BatchDecoder.h"
+
+namespace mackieControl {
+	BatchDecoder::BatchDecoder(int reserveSize) {
+		this->notes.samplePositions.reserve(reserveSize);
+		this->notes.types.reserve(reserveSize);
+		this->notes.velocities.reserve(reserveSize);
+
+		this->ccs.samplePositions.reserve(reserveSize);
+		this->ccs.types.reserve(reserveSize);
+		this->ccs.values.reserve(reserveSize);
+
+		this->faders.samplePositions.reserve(reserveSize);
+		this->faders.channels.reserve(reserveSize);
+		this->faders.values.reserve(reserveSize);
+
+		this->meters.samplePositions.reserve(reserveSize);
+		this->meters.channels.reserve(reserveSize);
+		this->meters.values.reserve(reserveSize);
+
+		this->sysExs.samplePositions.reserve(reserveSize);
+		this->sysExs.types.reserve(reserveSize);
+		this->sysExs.messages.reserve(reserveSize);
+
+		this->clear();
+	}
+
+	void BatchDecoder::decode(const juce::MidiBuffer& buffer) {
+		this->clear();
+
+		for (const auto metadata : buffer) {
+			const uint8_t* data = metadata.data;
+			int size = metadata.numBytes;
+			int position = metadata.samplePosition;
+
+			switch (classifyMessage(data, size)) {
+			case MessageType::Note:
+				this->notes.samplePositions.push_back(position);
+				this->notes.types.push_back(static_cast<NoteMessage>(data[1]));
+				this->notes.velocities.push_back(static_cast<VelocityMessage>(data[2]));
+				break;
+			case MessageType::CC:
+				this->ccs.samplePositions.push_back(position);
+				this->ccs.types.push_back(static_cast<CCMessage>(data[1]));
+				this->ccs.values.push_back(data[2]);
+				break;
+			case MessageType::PitchWheel: {
+				int channel = (data[0] & 0x0F) + 1;
+				int value = data[1] | (data[2] << 7);
+				this->faders.samplePositions.push_back(position);
+				this->faders.channels.push_back(channel);
+				this->faders.values.push_back(value);
+				this->faders.lastValues[channel - 1] = value;
+				break;
+			}
+			case MessageType::ChannelPressure:
+				this->meters.samplePositions.push_back(position);
+				this->meters.channels.push_back(data[1] / 16 + 1);
+				this->meters.values.push_back(data[1] % 16);
+				break;
+			case MessageType::SysEx:
+				this->sysExs.samplePositions.push_back(position);
+				this->sysExs.types.push_back(static_cast<SysExMessage>(data[1 + 4]));
+				this->sysExs.messages.emplace_back(data, size);
+				break;
+			default:
+				this->numInvalid++;
+				break;
+			}
+		}
+	}
+
+	void BatchDecoder::clear() {
+		this->notes.samplePositions.clear();
+		this->notes.types.clear();
+		this->notes.velocities.clear();
+
+		this->ccs.samplePositions.clear();
+		this->ccs.types.clear();
+		this->ccs.values.clear();
+
+		this->faders.samplePositions.clear();
+		this->faders.channels.clear();
+		this->faders.values.clear();
+		this->faders.lastValues.fill(-1);
+
+		this->meters.samplePositions.clear();
+		this->meters.channels.clear();
+		this->meters.values.clear();
+
+		this->sysExs.samplePositions.clear();
+		this->sysExs.types.clear();
+		this->sysExs.messages.clear();
+
+		this->numInvalid = 0;
+	}
+
+	const NoteColumns& BatchDecoder::getNotes() const {
+		return this->notes;
+	}
+
+	const CCColumns& BatchDecoder::getCCs() const {
+		return this->ccs;
+	}
+
+	const FaderColumns& BatchDecoder::getFaders() const {
+		return this->faders;
+	}
+
+	const MeterColumns& BatchDecoder::getMeters() const {
+		return this->meters;
+	}
+
+	const SysExColumns& BatchDecoder::getSysExs() const {
+		return this->sysExs;
+	}
+
+	int BatchDecoder::getNumInvalid() const {
+		return this->numInvalid;
+	}
+}
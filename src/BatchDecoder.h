@@ -0,0 +1,121 @@
+﻿/*****************************************************************//**
+ * \file	BatchDecoder.h
+ * \brief	Decode a whole MIDI buffer into per-kind Mackie Control event columns.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ *********************************************************************/
+
+#pragma once
+
+#include "MessageView.h"
+
+namespace mackieControl {
+	/**
+	 * Note events in structure-of-arrays layout.
+	 */
+	struct MACKIE_API NoteColumns final {
+		std::vector<int> samplePositions;
+		std::vector<NoteMessage> types;
+		std::vector<VelocityMessage> velocities;
+	};
+
+	/**
+	 * CC events in structure-of-arrays layout.
+	 */
+	struct MACKIE_API CCColumns final {
+		std::vector<int> samplePositions;
+		std::vector<CCMessage> types;
+		std::vector<int> values;
+	};
+
+	/**
+	 * Pitch wheel (fader) events in structure-of-arrays layout.
+	 */
+	struct MACKIE_API FaderColumns final {
+		std::vector<int> samplePositions;
+		std::vector<int> channels;
+		std::vector<int> values;
+
+		/** Last fader value of each channel (1-9) in the block, -1 if the channel has no event. */
+		std::array<int, 9> lastValues;
+	};
+
+	/**
+	 * Channel pressure (meter) events in structure-of-arrays layout.
+	 */
+	struct MACKIE_API MeterColumns final {
+		std::vector<int> samplePositions;
+		std::vector<int> channels;
+		std::vector<int> values;
+	};
+
+	/**
+	 * System exclusive events in structure-of-arrays layout.
+	 * The message views point into the decoded MIDI buffer and are valid until the buffer changes.
+	 */
+	struct MACKIE_API SysExColumns final {
+		std::vector<int> samplePositions;
+		std::vector<SysExMessage> types;
+		std::vector<MessageView> messages;
+	};
+
+	/**
+	 * Decode a whole MIDI buffer into per-kind event columns in one pass.
+	 * The columns keep their capacity between blocks, so steady-state decoding doesn't allocate.
+	 */
+	class MACKIE_API BatchDecoder final {
+	public:
+		/**
+		 * Create a batch decoder.
+		 * \param reserveSize	Events reserved for each column
+		 */
+		explicit BatchDecoder(int reserveSize = 256);
+
+		/**
+		 * Clear all columns and decode the MIDI buffer into them.
+		 */
+		void decode(const juce::MidiBuffer& buffer);
+		/**
+		 * Clear all columns without freeing their storage.
+		 */
+		void clear();
+
+		/**
+		 * Get the decoded note events.
+		 */
+		const NoteColumns& getNotes() const;
+		/**
+		 * Get the decoded CC events.
+		 */
+		const CCColumns& getCCs() const;
+		/**
+		 * Get the decoded pitch wheel (fader) events.
+		 */
+		const FaderColumns& getFaders() const;
+		/**
+		 * Get the decoded channel pressure (meter) events.
+		 */
+		const MeterColumns& getMeters() const;
+		/**
+		 * Get the decoded system exclusive events.
+		 */
+		const SysExColumns& getSysExs() const;
+		/**
+		 * Get the count of events which are not Mackie Control messages in the last block.
+		 */
+		int getNumInvalid() const;
+
+	private:
+		NoteColumns notes;
+		CCColumns ccs;
+		FaderColumns faders;
+		MeterColumns meters;
+		SysExColumns sysExs;
+		int numInvalid = 0;
+
+		JUCE_LEAK_DETECTOR(BatchDecoder)
+	};
+}
@@ -0,0 +1,186 @@
+/*****************************************************************//**
+ * \file	Capture.cpp
+ * \brief	Binary capture and replay of Mackie Control traffic.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ *********************************************************************/
+
+#include "Capture.h"
+
+namespace mackieControl {
+	/** Max raw size of short messages stored inline. */
+	constexpr int maxInlineSize = 3;
+	/** Seconds before a replayed record which are waited by spinning instead of sleeping. */
+	constexpr double spinTime = 0.002;
+	/** Max seconds of one sleep while waiting for a replayed record, so a stop request is seen in time. */
+	constexpr double maxSleepTime = 0.05;
+
+	static_assert(std::is_trivially_copyable_v<CaptureRecord> && sizeof(CaptureRecord) == 16);
+	static_assert(std::is_trivially_copyable_v<CaptureHeader> && sizeof(CaptureHeader) == 24);
+	static_assert(offsetof(CaptureRecord, data) == 12);
+
+	CaptureWriter::CaptureWriter(int maxRecords, int payloadCapacity) {
+		this->records.resize(std::max(maxRecords, 0));
+		this->payloads.resize(std::max(payloadCapacity, 0));
+	}
+
+	bool CaptureWriter::record(CaptureDirection direction, const MessageView& message, double timeStamp) {
+		auto data = message.getRawData();
+		if (data.empty()) { return false; }
+
+		uint32_t index = this->numRecords.load(std::memory_order_relaxed);
+		if (index >= this->records.size() || data.size() > std::numeric_limits<uint16_t>::max()) {
+			this->numDropped.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+
+		CaptureRecord record;
+		record.timeStamp = timeStamp;
+		record.direction = direction;
+		record.type = message.getType();
+		record.size = static_cast<uint16_t>(data.size());
+
+		if (record.size <= maxInlineSize) {
+			std::memcpy(&record.data, data.data(), record.size);
+		}
+		else {
+			if (record.size > this->payloads.size() - this->payloadSize) {
+				this->numDropped.fetch_add(1, std::memory_order_relaxed);
+				return false;
+			}
+
+			record.data = this->payloadSize;
+			std::memcpy(&(this->payloads[this->payloadSize]), data.data(), record.size);
+			this->payloadSize += record.size;
+		}
+
+		this->records[index] = record;
+
+		// Publish the record and its payload to the saving thread
+		this->numRecords.store(index + 1, std::memory_order_release);
+		return true;
+	}
+
+	int CaptureWriter::record(CaptureDirection direction, const juce::MidiBuffer& buffer, double timeStamp, double sampleRate) {
+		int count = 0;
+		for (const auto metadata : buffer) {
+			double time = timeStamp + ((sampleRate > 0) ? (metadata.samplePosition / sampleRate) : 0);
+			count += this->record(direction, MessageView{ metadata.data, metadata.numBytes }, time) ? 1 : 0;
+		}
+		return count;
+	}
+
+	bool CaptureWriter::save(const juce::File& file) const {
+		// Lets clear() check that no save is running
+		this->numSaving.fetch_add(1, std::memory_order_acq_rel);
+		struct SavingScope final {
+			std::atomic<int>& numSaving;
+			~SavingScope() { this->numSaving.fetch_sub(1, std::memory_order_acq_rel); }
+		} savingScope{ this->numSaving };
+
+		uint32_t count = this->numRecords.load(std::memory_order_acquire);
+
+		// The payload of the published records ends after the last SysEx record among them
+		uint64_t payloadEnd = 0;
+		for (uint32_t i = 0; i < count; i++) {
+			auto& record = this->records[i];
+			if (record.size > maxInlineSize) {
+				payloadEnd = std::max<uint64_t>(payloadEnd, static_cast<uint64_t>(record.data) + record.size);
+			}
+		}
+
+		CaptureHeader header;
+		header.magic = CaptureWriter::magic;
+		header.version = CaptureWriter::version;
+		header.numRecords = count;
+		header.payloadSize = payloadEnd;
+
+		juce::FileOutputStream stream{ file };
+		if (!stream.openedOk()) { return false; }
+		stream.setPosition(0);
+		stream.truncate();
+
+		bool result = stream.write(&header, sizeof(header))
+			&& stream.write(this->records.data(), count * sizeof(CaptureRecord))
+			&& stream.write(this->payloads.data(), static_cast<size_t>(payloadEnd));
+		stream.flush();
+		return result;
+	}
+
+	void CaptureWriter::clear() {
+		// Saving while the records are dropped would write records whose payloads are being overwritten
+		jassert(this->numSaving.load(std::memory_order_acquire) == 0);
+
+		this->numRecords.store(0, std::memory_order_relaxed);
+		this->numDropped.store(0, std::memory_order_relaxed);
+		this->payloadSize = 0;
+	}
+
+	int CaptureWriter::getNumRecords() const {
+		return static_cast<int>(this->numRecords.load(std::memory_order_acquire));
+	}
+
+	uint64_t CaptureWriter::getNumDropped() const {
+		return this->numDropped.load(std::memory_order_relaxed);
+	}
+
+	CaptureReader::CaptureReader(const juce::File& file)
+		: file(std::make_unique<juce::MemoryMappedFile>(file, juce::MemoryMappedFile::readOnly)) {
+		auto data = static_cast<const uint8_t*>(this->file->getData());
+		uint64_t size = this->file->getSize();
+		if (!data || size < sizeof(CaptureHeader)) { return; }
+
+		CaptureHeader header;
+		std::memcpy(&header, data, sizeof(header));
+		if (header.magic != CaptureWriter::magic || header.version != CaptureWriter::version) { return; }
+
+		uint64_t recordsSize = static_cast<uint64_t>(header.numRecords) * sizeof(CaptureRecord);
+		if (sizeof(CaptureHeader) + recordsSize + header.payloadSize > size) { return; }
+
+		this->records = data + sizeof(CaptureHeader);
+		this->payloads = this->records + recordsSize;
+		this->numRecords = static_cast<int>(std::min<uint64_t>(header.numRecords, std::numeric_limits<int>::max()));
+		this->payloadSize = header.payloadSize;
+	}
+
+	bool CaptureReader::isValid() const {
+		return this->records != nullptr;
+	}
+
+	int CaptureReader::getNumRecords() const {
+		return this->numRecords;
+	}
+
+	std::tuple<CaptureRecord, MessageView> CaptureReader::getRecord(int index) const {
+		if (index < 0 || index >= this->numRecords) { return { CaptureRecord{}, MessageView{} }; }
+
+		// Mapped records may be unaligned
+		const uint8_t* bytes = this->records + static_cast<size_t>(index) * sizeof(CaptureRecord);
+		CaptureRecord record;
+		std::memcpy(&record, bytes, sizeof(record));
+
+		if (record.size <= maxInlineSize) {
+			return { record, MessageView{ bytes + offsetof(CaptureRecord, data), record.size } };
+		}
+		if (static_cast<uint64_t>(record.data) + record.size > this->payloadSize) {
+			return { record, MessageView{} };
+		}
+		return { record, MessageView{ this->payloads + record.data, record.size } };
+	}
+
+	void CaptureReader::waitUntil(double time, const std::atomic<bool>* shouldStop) {
+		// Sleep most of the wait in short slices and spin the rest for accurate timing
+		for (;;) {
+			if (shouldStop && shouldStop->load(std::memory_order_relaxed)) { return; }
+
+			double remaining = time - juce::Time::getMillisecondCounterHiRes() * 0.001;
+			if (remaining <= 0) { return; }
+			if (remaining > spinTime) {
+				juce::Thread::sleep(static_cast<int>(std::min(remaining - spinTime, maxSleepTime) * 1000));
+			}
+		}
+	}
+}
@@ -0,0 +1,268 @@
+﻿/*****************************************************************//**
+ * \file	Capture.h
+ * \brief	Binary capture and replay of Mackie Control traffic.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ *********************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+#include "StreamParser.h"
+#include "BatchDecoder.h"
+
+namespace mackieControl {
+	/**
+	 * Direction of a captured message.
+	 */
+	enum class MACKIE_API CaptureDirection : uint8_t {
+		Inbound,
+		Outbound
+	};
+
+	/**
+	 * Fixed-size record of a captured message.
+	 * Short messages are stored inline in data. MIDI system exclusive messages store the offset of their bytes
+	 * in the payload region in data.
+	 */
+	struct MACKIE_API CaptureRecord final {
+		/** Time Stamp in Seconds */
+		double timeStamp = 0;
+		/** Direction */
+		CaptureDirection direction = CaptureDirection::Inbound;
+		/** Message Type */
+		MessageType type = MessageType::Invalid;
+		/** Raw MIDI Size */
+		uint16_t size = 0;
+		/** Raw MIDI bytes of short messages in memory order, or the payload offset of MIDI system exclusive messages */
+		uint32_t data = 0;
+	};
+
+	/**
+	 * Header of a capture file.
+	 * The file is the header, then numRecords records, then payloadSize bytes of payload, in the byte order of the capturing machine.
+	 */
+	struct MACKIE_API CaptureHeader final {
+		/** File Magic */
+		std::array<char, 8> magic{};
+		/** Format Version */
+		uint32_t version = 0;
+		/** Count of records */
+		uint32_t numRecords = 0;
+		/** Size of the payload region */
+		uint64_t payloadSize = 0;
+	};
+
+	/**
+	 * Writer of captured messages.
+	 * All memory is allocated on construction. Recording never allocates or locks, so it is safe on the realtime thread.
+	 * Messages are recorded by one thread. Another thread may save the messages recorded so far at any time.
+	 */
+	class MACKIE_API CaptureWriter final {
+	public:
+		/** File magic of capture files. */
+		static constexpr std::array<char, 8> magic = { 'M', 'C', 'K', 'C', 'A', 'P', 'T', 'R' };
+		/** Format version of capture files. */
+		static constexpr uint32_t version = 1;
+
+		/**
+		 * Create a capture writer.
+		 * \param maxRecords	Max count of recorded messages
+		 * \param payloadCapacity	Max total size of recorded MIDI system exclusive messages
+		 */
+		explicit CaptureWriter(int maxRecords = 65536, int payloadCapacity = 1 << 20);
+
+		/**
+		 * Record a message. Called by the recording thread only.
+		 * \param direction		Direction
+		 * \param message		Message
+		 * \param timeStamp		Time Stamp in Seconds
+		 * \return	False if the message is empty or the capture is full
+		 */
+		bool record(CaptureDirection direction, const MessageView& message, double timeStamp);
+		/**
+		 * Record all events of a MIDI buffer. Called by the recording thread only.
+		 * \param direction		Direction
+		 * \param buffer		MIDI Buffer
+		 * \param timeStamp		Time Stamp of sample position 0
+		 * \param sampleRate	Sample Rate used to convert sample positions to time
+		 * \return	Count of recorded events
+		 */
+		int record(CaptureDirection direction, const juce::MidiBuffer& buffer, double timeStamp, double sampleRate);
+
+		/**
+		 * Write the messages recorded so far into a file.
+		 * \return	False if the file can't be written
+		 */
+		bool save(const juce::File& file) const;
+		/**
+		 * Drop all recorded messages. Called by the recording thread while no other thread saves.
+		 */
+		void clear();
+
+		/**
+		 * Get the count of recorded messages.
+		 */
+		int getNumRecords() const;
+		/**
+		 * Get the count of messages dropped because the capture was full.
+		 */
+		uint64_t getNumDropped() const;
+
+	private:
+		std::vector<CaptureRecord> records;
+		std::vector<uint8_t> payloads;
+		uint32_t payloadSize = 0;
+
+		std::atomic<uint32_t> numRecords{ 0 };
+		std::atomic<uint64_t> numDropped{ 0 };
+		mutable std::atomic<int> numSaving{ 0 };
+
+		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(CaptureWriter)
+	};
+
+	/**
+	 * Reader of capture files.
+	 * The file is memory-mapped, so records are read in place without loading the capture.
+	 */
+	class MACKIE_API CaptureReader final {
+	public:
+		/**
+		 * Open a capture file.
+		 */
+		explicit CaptureReader(const juce::File& file);
+
+		/**
+		 * Check if the file is a valid capture.
+		 */
+		bool isValid() const;
+		/**
+		 * Get the count of records.
+		 */
+		int getNumRecords() const;
+		/**
+		 * Get a record.
+		 * \param index			Record Index
+		 * \return	Record, a view on the message valid while the reader lives
+		 */
+		std::tuple<CaptureRecord, MessageView> getRecord(int index) const;
+
+		/**
+		 * Pass each record with its message view to the handler.
+		 * \param handler		void(const CaptureRecord&, const MessageView&)
+		 * \param realTime		Wait between records as long as when they were captured, or replay at max speed
+		 * \param shouldStop	Flag set by another thread to stop the replay, or nullptr
+		 * \return	Count of replayed records
+		 */
+		template <typename Handler>
+		int replay(Handler&& handler, bool realTime = false, const std::atomic<bool>* shouldStop = nullptr) const {
+			int count = this->getNumRecords();
+			if (count == 0) { return 0; }
+
+			double startTime = juce::Time::getMillisecondCounterHiRes() * 0.001;
+			double firstTimeStamp = std::get<0>(this->getRecord(0)).timeStamp;
+			for (int i = 0; i < count; i++) {
+				auto [record, message] = this->getRecord(i);
+				if (realTime) {
+					CaptureReader::waitUntil(startTime + (record.timeStamp - firstTimeStamp), shouldStop);
+				}
+				if (shouldStop && shouldStop->load(std::memory_order_relaxed)) { return i; }
+
+				handler(static_cast<const CaptureRecord&>(record), static_cast<const MessageView&>(message));
+			}
+			return count;
+		}
+		/**
+		 * Feed the raw bytes of each record of one direction to a stream parser, as a serial transport delivers them.
+		 * \param parser		Stream Parser
+		 * \param direction		Direction of fed records
+		 * \param handler		void(const CaptureRecord&, const MessageView&), called for each message completed by the parser
+		 * \param realTime		Wait between records as long as when they were captured, or replay at max speed
+		 * \param shouldStop	Flag set by another thread to stop the replay, or nullptr
+		 * \return	Count of fed records
+		 */
+		template <typename Handler>
+		int replay(StreamParser& parser, CaptureDirection direction, Handler&& handler,
+			bool realTime = false, const std::atomic<bool>* shouldStop = nullptr) const {
+			int count = 0;
+			this->replay([&parser, direction, &handler, &count](const CaptureRecord& record, const MessageView& message) {
+				if (record.direction != direction) { return; }
+
+				parser.parse(message.getRawData(), [&record, &handler](const MessageView& parsed) {
+					handler(record, parsed);
+					});
+				count++;
+				}, realTime, shouldStop);
+			return count;
+		}
+		/**
+		 * Collect the records of one direction into MIDI buffers of fixed duration and decode each buffer with a batch decoder.
+		 * Blocks are counted from the first record of the direction, blocks without records are skipped.
+		 * \param decoder		Batch Decoder
+		 * \param direction		Direction of decoded records
+		 * \param blockDuration	Duration of each block in seconds
+		 * \param sampleRate	Sample Rate used to convert time stamps to sample positions in the block
+		 * \param handler		void(double blockTime, const BatchDecoder&), called after each block is decoded
+		 * \param realTime		Wait between records as long as when they were captured, or replay at max speed
+		 * \param shouldStop	Flag set by another thread to stop the replay, or nullptr
+		 * \return	Count of decoded records
+		 */
+		template <typename Handler>
+		int replay(BatchDecoder& decoder, CaptureDirection direction, double blockDuration, double sampleRate, Handler&& handler,
+			bool realTime = false, const std::atomic<bool>* shouldStop = nullptr) const {
+			if (blockDuration <= 0) { return 0; }
+
+			juce::MidiBuffer buffer;
+			double firstTime = 0, blockTime = 0;
+			bool started = false, pending = false;
+			auto flushBlock = [&decoder, &handler, &buffer, &blockTime, &pending] {
+				decoder.decode(buffer);
+				handler(blockTime, static_cast<const BatchDecoder&>(decoder));
+				buffer.clear();
+				pending = false;
+			};
+
+			int count = 0;
+			this->replay([&](const CaptureRecord& record, const MessageView& message) {
+				auto data = message.getRawData();
+				if (record.direction != direction || data.empty()) { return; }
+
+				if (!started) {
+					firstTime = record.timeStamp;
+					started = true;
+				}
+				double time = firstTime + std::floor((record.timeStamp - firstTime) / blockDuration) * blockDuration;
+				if (pending && time != blockTime) {
+					flushBlock();
+				}
+
+				blockTime = time;
+				buffer.addEvent(data.data(), static_cast<int>(data.size()),
+					static_cast<int>((record.timeStamp - blockTime) * sampleRate));
+				pending = true;
+				count++;
+				}, realTime, shouldStop);
+
+			if (pending) {
+				flushBlock();
+			}
+			return count;
+		}
+
+	private:
+		std::unique_ptr<juce::MemoryMappedFile> file;
+		const uint8_t* records = nullptr;
+		const uint8_t* payloads = nullptr;
+		int numRecords = 0;
+		uint64_t payloadSize = 0;
+
+		static void waitUntil(double time, const std::atomic<bool>* shouldStop);
+
+		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(CaptureReader)
+	};
+}
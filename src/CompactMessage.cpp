@@ -0,0 +1,156 @@
+/*****************************************************************//**
+ * \file	CompactMessage.cpp
+ * \brief	Trivially copyable 8-byte Mackie Control message.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ *********************************************************************/
+
+#include "CompactMessage.h"
+
+namespace mackieControl {
+	SysExStore::SysExStore(int reserveBytes, int reserveMessages) {
+		this->bytes.reserve(reserveBytes);
+		this->messages.reserve(reserveMessages);
+	}
+
+	uint32_t SysExStore::add(std::span<const uint8_t> data) {
+		uint32_t offset = static_cast<uint32_t>(this->bytes.size());
+		this->bytes.insert(this->bytes.end(), data.begin(), data.end());
+		this->messages.emplace_back(offset, static_cast<uint32_t>(data.size()));
+		return static_cast<uint32_t>(this->messages.size() - 1);
+	}
+
+	MessageView SysExStore::get(uint32_t handle) const {
+		if (handle >= this->messages.size()) { return MessageView{}; }
+
+		auto [offset, size] = this->messages[handle];
+		return MessageView{ std::span<const uint8_t>{ this->bytes }.subspan(offset, size) };
+	}
+
+	int SysExStore::size() const {
+		return static_cast<int>(this->messages.size());
+	}
+
+	void SysExStore::clear() {
+		this->bytes.clear();
+		this->messages.clear();
+	}
+
+	CompactMessage CompactMessage::fromView(const MessageView& message, SysExStore* store) {
+		auto data = message.getRawData();
+		switch (message.getType()) {
+		case MessageType::Invalid:
+			return CompactMessage{};
+		case MessageType::SysEx: {
+			if (!store) { return CompactMessage{}; }
+
+			CompactMessage result{ 0xF0, data[1 + 4], 0 };
+			result.type = MessageType::SysEx;
+			result.payload = store->add(data);
+			return result;
+		}
+		default:
+			return CompactMessage{ data[0], data[1], (data.size() >= 3) ? data[2] : static_cast<uint8_t>(0) };
+		}
+	}
+
+	CompactMessage CompactMessage::fromMessage(const Message& message, SysExStore* store) {
+		return CompactMessage::fromView(MessageView{ message }, store);
+	}
+
+	Message CompactMessage::toMessage(const SysExStore* store) const {
+		return this->getView(store).toMessage();
+	}
+
+	MessageView CompactMessage::getView(const SysExStore* store) const {
+		switch (this->type) {
+		case MessageType::Invalid:
+			return MessageView{};
+		case MessageType::SysEx:
+			return store ? store->get(this->payload) : MessageView{};
+		default:
+			return MessageView{ this->bytes.data(), this->getShortSize() };
+		}
+	}
+
+	MessageType CompactMessage::getType() const {
+		return this->type;
+	}
+
+	bool CompactMessage::isSysEx() const {
+		return this->type == MessageType::SysEx;
+	}
+
+	bool CompactMessage::isNote() const {
+		return this->type == MessageType::Note;
+	}
+
+	bool CompactMessage::isCC() const {
+		return this->type == MessageType::CC;
+	}
+
+	bool CompactMessage::isPitchWheel() const {
+		return this->type == MessageType::PitchWheel;
+	}
+
+	bool CompactMessage::isChannelPressure() const {
+		return this->type == MessageType::ChannelPressure;
+	}
+
+	bool CompactMessage::isMackieControl() const {
+		return this->type != MessageType::Invalid;
+	}
+
+	std::tuple<SysExMessage> CompactMessage::getSysExData() const {
+		if (this->type != MessageType::SysEx) { return { static_cast<SysExMessage>(-1) }; }
+		return { static_cast<SysExMessage>(this->bytes[1]) };
+	}
+
+	uint32_t CompactMessage::getSysExPayload() const {
+		return this->payload;
+	}
+
+	std::tuple<NoteMessage, VelocityMessage> CompactMessage::getNoteData() const {
+		return { static_cast<NoteMessage>(this->bytes[1]),
+			static_cast<VelocityMessage>(this->bytes[2]) };
+	}
+
+	std::tuple<CCMessage, int> CompactMessage::getCCData() const {
+		return { static_cast<CCMessage>(this->bytes[1]),
+			this->bytes[2] };
+	}
+
+	std::tuple<int, int> CompactMessage::getPitchWheelData() const {
+		return { (this->bytes[0] & 0x0F) + 1,
+			this->bytes[1] | (this->bytes[2] << 7) };
+	}
+
+	std::tuple<int, int> CompactMessage::getChannelPressureData() const {
+		int value = this->bytes[1];
+		return { value / 16 + 1,value % 16 };
+	}
+
+	CompactMessage CompactMessage::createNote(NoteMessage type, VelocityMessage vel) {
+		return CompactMessage{ 0x90, static_cast<uint8_t>(type), static_cast<uint8_t>(vel) };
+	}
+
+	CompactMessage CompactMessage::createCC(CCMessage type, int value) {
+		return CompactMessage{ 0xB0, static_cast<uint8_t>(type), static_cast<uint8_t>(value & 0x7F) };
+	}
+
+	CompactMessage CompactMessage::createPitchWheel(int channel, int value) {
+		return CompactMessage{ static_cast<uint8_t>(0xE0 | ((channel - 1) & 0x0F)),
+			static_cast<uint8_t>(value & 0x7F), static_cast<uint8_t>((value >> 7) & 0x7F) };
+	}
+
+	CompactMessage CompactMessage::createChannelPressure(int channel, int value) {
+		return CompactMessage{ 0xD0, static_cast<uint8_t>(((channel - 1) * 16 + value) & 0x7F), 0 };
+	}
+
+	int CompactMessage::getShortSize() const {
+		return (this->type == MessageType::ChannelPressure) ? 2 : 3;
+	}
+}
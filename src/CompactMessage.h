@@ -0,0 +1,190 @@
+﻿/*****************************************************************//**
+ * \file	CompactMessage.h
+ * \brief	Trivially copyable 8-byte Mackie Control message.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ *********************************************************************/
+
+#pragma once
+
+#include "MessageView.h"
+
+namespace mackieControl {
+	/**
+	 * Storage of MIDI system exclusive messages referenced by compact messages.
+	 * Messages are appended to one byte arena, so the store only allocates when it grows.
+	 */
+	class MACKIE_API SysExStore final {
+	public:
+		/**
+		 * Create a store.
+		 * \param reserveBytes		Bytes reserved for messages
+		 * \param reserveMessages	Count of messages reserved
+		 */
+		explicit SysExStore(int reserveBytes = 4096, int reserveMessages = 64);
+
+		/**
+		 * Copy the raw MIDI bytes of a message into the store.
+		 * The storage may grow, which invalidates every MessageView returned by get() or CompactMessage::getView() before.
+		 * Payload handles stay valid, so keep handles and get the views again after adding.
+		 * \return	Payload Handle
+		 */
+		uint32_t add(std::span<const uint8_t> data);
+		/**
+		 * Get the message of the payload handle.
+		 * The view points into the store, and is valid until the next add() or clear().
+		 */
+		MessageView get(uint32_t handle) const;
+		/**
+		 * Get the count of stored messages.
+		 */
+		int size() const;
+		/**
+		 * Remove all messages without freeing the storage. All payload handles become invalid.
+		 */
+		void clear();
+
+	private:
+		std::vector<uint8_t> bytes;
+		std::vector<std::pair<uint32_t, uint32_t>> messages;
+
+		JUCE_LEAK_DETECTOR(SysExStore)
+	};
+
+	/**
+	 * Trivially copyable 8-byte Mackie Control message.
+	 * Note, CC, pitch wheel and channel pressure messages are stored inline.
+	 * MIDI system exclusive messages are stored in a SysExStore and referenced by a payload handle.
+	 */
+	class MACKIE_API CompactMessage final {
+	public:
+		/**
+		 * Create an empty message. An empty message is an invalid Mackie Control message.
+		 */
+		constexpr CompactMessage() = default;
+
+		/**
+		 * Create a compact message from a message view. MIDI system exclusive messages are copied into the store.
+		 * Without a store, MIDI system exclusive messages become invalid messages.
+		 */
+		static CompactMessage fromView(const MessageView& message, SysExStore* store = nullptr);
+		/**
+		 * Create a compact message from a Mackie Control message. MIDI system exclusive messages are copied into the store.
+		 * Without a store, MIDI system exclusive messages become invalid messages.
+		 */
+		static CompactMessage fromMessage(const Message& message, SysExStore* store = nullptr);
+		/**
+		 * Create a Mackie Control message from this message.
+		 * \param store			Store of MIDI system exclusive messages
+		 */
+		Message toMessage(const SysExStore* store = nullptr) const;
+		/**
+		 * Get a view on this message.
+		 * The view of a MIDI system exclusive message points into the store and is valid until the next add() or clear() of the store.
+		 * \param store			Store of MIDI system exclusive messages
+		 */
+		MessageView getView(const SysExStore* store = nullptr) const;
+
+		/**
+		 * Get the kind of this Mackie Control message.
+		 */
+		MessageType getType() const;
+		/**
+		 * Check if this message is a valid Mackie Control message via MIDI system exclusive message.
+		 */
+		bool isSysEx() const;
+		/**
+		 * Check if this message is a valid Mackie Control message via MIDI note message.
+		 */
+		bool isNote() const;
+		/**
+		 * Check if this message is a valid Mackie Control message via MIDI controller message.
+		 */
+		bool isCC() const;
+		/**
+		 * Check if this message is a valid Mackie Control message via MIDI pitch wheel message.
+		 */
+		bool isPitchWheel() const;
+		/**
+		 * Check if this message is a valid Mackie Control message via MIDI channel pressure message.
+		 */
+		bool isChannelPressure() const;
+		/**
+		 * Check if this message is a valid Mackie Control message.
+		 */
+		bool isMackieControl() const;
+
+		/**
+		 * Get the type of Mackie Control message via MIDI system exclusive message.
+		 * \return	Message Type
+		 */
+		std::tuple<SysExMessage> getSysExData() const;
+		/**
+		 * Get the payload handle of MIDI system exclusive message in SysExStore.
+		 */
+		uint32_t getSysExPayload() const;
+		/**
+		 * Get the type of Mackie Control message via MIDI note message.
+		 * \return	Message Type, Message On/Off Type
+		 */
+		std::tuple<NoteMessage, VelocityMessage> getNoteData() const;
+		/**
+		 * Get the type of Mackie Control message via MIDI controller message.
+		 * \return	Message Type, Value
+		 */
+		std::tuple<CCMessage, int> getCCData() const;
+		/**
+		 * Get the type of Mackie Control message via MIDI pitch wheel message.
+		 * \return	Channel Number, Fader Value
+		 */
+		std::tuple<int, int> getPitchWheelData() const;
+		/**
+		 * Get the type of Mackie Control message via MIDI channel pressure message.
+		 * \return	Meter Channel Number, Meter Value
+		 */
+		std::tuple<int, int> getChannelPressureData() const;
+
+		/**
+		 * Create a Mackie Control message via MIDI note message.
+		 * \param type			Message Type
+		 * \param vel			Message On/Off Type
+		 */
+		static CompactMessage createNote(NoteMessage type, VelocityMessage vel);
+		/**
+		 * Create a Mackie Control message via MIDI controller message.
+		 * \param type			Message Type
+		 * \param value			Value
+		 */
+		static CompactMessage createCC(CCMessage type, int value);
+		/**
+		 * Create a Mackie Control message via MIDI pitch wheel message.
+		 * \param channel		Channel Number
+		 * \param value			Fader Value
+		 */
+		static CompactMessage createPitchWheel(int channel, int value);
+		/**
+		 * Create a Mackie Control message via MIDI channel pressure message.
+		 * \param channel		Meter Channel Number
+		 * \param value			Meter Value
+		 */
+		static CompactMessage createChannelPressure(int channel, int value);
+
+	private:
+		/** Raw MIDI bytes of short messages, {0xF0, type, 0} of MIDI system exclusive message */
+		std::array<uint8_t, 3> bytes{};
+		MessageType type = MessageType::Invalid;
+		/** Payload handle of MIDI system exclusive message */
+		uint32_t payload = 0;
+
+		constexpr CompactMessage(uint8_t status, uint8_t data1, uint8_t data2)
+			: bytes{ status, data1, data2 }, type(classifyMessage(status, data1, data2)) {}
+
+		int getShortSize() const;
+	};
+
+	static_assert(sizeof(CompactMessage) == 8, "CompactMessage should be 8 bytes");
+	static_assert(std::is_trivially_copyable_v<CompactMessage>, "CompactMessage should be trivially copyable");
+}
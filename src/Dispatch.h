@@ -0,0 +1,251 @@
+﻿/*****************************************************************//**
+ * \file	Dispatch.h
+ * \brief	Typed visitor dispatch of Mackie Control messages via compile-time jump tables.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ *********************************************************************/
+
+#pragma once
+
+#include <utility>
+
+#include "MessageView.h"
+
+namespace mackieControl {
+	/**
+	 * Jump tables from the kind of Mackie Control message to the typed handlers of a visitor.
+	 * The tables are built at compile time. Handlers the visitor doesn't define are null entries,
+	 * so the message data of them is never decoded.
+	 *
+	 * Typed handlers of a visitor:
+	 *	onDeviceQuery()
+	 *	onHostConnectionQuery(std::array<uint8_t, 7> serial, uint32_t challenge)
+	 *	onHostConnectionReply(std::array<uint8_t, 7> serial, uint32_t response)
+	 *	onHostConnectionConfirmation(std::array<uint8_t, 7> serial)
+	 *	onHostConnectionError(std::array<uint8_t, 7> serial)
+	 *	onLCDBackLightSaver(uint8_t state, uint8_t timeout)
+	 *	onTouchlessMovableFaders(uint8_t state)
+	 *	onFaderTouchSensitivity(uint8_t channel, uint8_t value)
+	 *	onGoOffline()
+	 *	onTimeCodeBBTDisplay(const uint8_t* data, int size)
+	 *	onAssignment7SegmentDisplay(std::array<uint8_t, 2> data)
+	 *	onLCD(uint8_t place, const char* text, int size)
+	 *	onVersionRequest()
+	 *	onVersionReply(const char* version, int size)
+	 *	onChannelMeterMode(uint8_t channel, uint8_t mode)
+	 *	onGlobalLCDMeterMode(uint8_t mode)
+	 *	onAllFaderstoMinimum()
+	 *	onAllLEDsOff()
+	 *	onReset()
+	 *	onSysEx(SysExMessage type, const MessageView& message)	(MIDI system exclusive messages without a typed handler)
+	 *	onNote(NoteMessage type, VelocityMessage vel)
+	 *	onCC(CCMessage type, int value)
+	 *	onFader(int channel, int value)
+	 *	onMeter(int channel, int value)
+	 *	onInvalid(const MessageView& message)
+	 */
+	template <typename Visitor>
+	class Dispatcher final {
+	public:
+		Dispatcher() = delete;
+
+		/** Typed handler entry */
+		using Handler = void (*)(Visitor&, const MessageView&);
+
+		/**
+		 * Pass the message to the typed handler of the visitor.
+		 * \return	True if the visitor has a handler of the message
+		 */
+		static bool dispatch(const MessageView& message, Visitor& visitor) {
+			auto type = message.getType();
+			if (type == MessageType::SysEx) {
+				auto handler = Dispatcher::sysExTable[message.getRawData()[1 + 4] & 0x7F];
+				if (!handler) { return false; }
+				handler(visitor, message);
+				return true;
+			}
+
+			auto handler = Dispatcher::typeTable[static_cast<uint8_t>(type)];
+			if (!handler) { return false; }
+			handler(visitor, message);
+			return true;
+		}
+
+	private:
+		template <SysExMessage type>
+		static constexpr Handler getSysExHandler() {
+			if constexpr (type == SysExMessage::DeviceQuery
+				&& requires (Visitor& v) { v.onDeviceQuery(); }) {
+				return [](Visitor& visitor, const MessageView&) { visitor.onDeviceQuery(); };
+			}
+			else if constexpr (type == SysExMessage::HostConnectionQuery
+				&& requires (Visitor& v, std::array<uint8_t, 7> serial, uint32_t code) { v.onHostConnectionQuery(serial, code); }) {
+				return [](Visitor& visitor, const MessageView& message) {
+					auto [serial, challenge] = message.getHostConnectionQueryData();
+					visitor.onHostConnectionQuery(serial, challenge); };
+			}
+			else if constexpr (type == SysExMessage::HostConnectionReply
+				&& requires (Visitor& v, std::array<uint8_t, 7> serial, uint32_t code) { v.onHostConnectionReply(serial, code); }) {
+				return [](Visitor& visitor, const MessageView& message) {
+					auto [serial, response] = message.getHostConnectionReplyData();
+					visitor.onHostConnectionReply(serial, response); };
+			}
+			else if constexpr (type == SysExMessage::HostConnectionConfirmation
+				&& requires (Visitor& v, std::array<uint8_t, 7> serial) { v.onHostConnectionConfirmation(serial); }) {
+				return [](Visitor& visitor, const MessageView& message) {
+					auto [serial] = message.getHostConnectionConfirmationData();
+					visitor.onHostConnectionConfirmation(serial); };
+			}
+			else if constexpr (type == SysExMessage::HostConnectionError
+				&& requires (Visitor& v, std::array<uint8_t, 7> serial) { v.onHostConnectionError(serial); }) {
+				return [](Visitor& visitor, const MessageView& message) {
+					auto [serial] = message.getHostConnectionErrorData();
+					visitor.onHostConnectionError(serial); };
+			}
+			else if constexpr (type == SysExMessage::LCDBackLightSaver
+				&& requires (Visitor& v, uint8_t a, uint8_t b) { v.onLCDBackLightSaver(a, b); }) {
+				return [](Visitor& visitor, const MessageView& message) {
+					auto [state, timeout] = message.getLCDBackLightSaverData();
+					visitor.onLCDBackLightSaver(state, timeout); };
+			}
+			else if constexpr (type == SysExMessage::TouchlessMovableFaders
+				&& requires (Visitor& v, uint8_t a) { v.onTouchlessMovableFaders(a); }) {
+				return [](Visitor& visitor, const MessageView& message) {
+					auto [state] = message.getTouchlessMovableFadersData();
+					visitor.onTouchlessMovableFaders(state); };
+			}
+			else if constexpr (type == SysExMessage::FaderTouchSensitivity
+				&& requires (Visitor& v, uint8_t a, uint8_t b) { v.onFaderTouchSensitivity(a, b); }) {
+				return [](Visitor& visitor, const MessageView& message) {
+					auto [channel, value] = message.getFaderTouchSensitivityData();
+					visitor.onFaderTouchSensitivity(channel, value); };
+			}
+			else if constexpr (type == SysExMessage::GoOffline
+				&& requires (Visitor& v) { v.onGoOffline(); }) {
+				return [](Visitor& visitor, const MessageView&) { visitor.onGoOffline(); };
+			}
+			else if constexpr (type == SysExMessage::TimeCodeBBTDisplay
+				&& requires (Visitor& v, const uint8_t* data, int size) { v.onTimeCodeBBTDisplay(data, size); }) {
+				return [](Visitor& visitor, const MessageView& message) {
+					auto [data, size] = message.getTimeCodeBBTDisplayData();
+					visitor.onTimeCodeBBTDisplay(data, size); };
+			}
+			else if constexpr (type == SysExMessage::Assignment7SegmentDisplay
+				&& requires (Visitor& v, std::array<uint8_t, 2> data) { v.onAssignment7SegmentDisplay(data); }) {
+				return [](Visitor& visitor, const MessageView& message) {
+					auto [data] = message.getAssignment7SegmentDisplayData();
+					visitor.onAssignment7SegmentDisplay(data); };
+			}
+			else if constexpr (type == SysExMessage::LCD
+				&& requires (Visitor& v, uint8_t place, const char* text, int size) { v.onLCD(place, text, size); }) {
+				return [](Visitor& visitor, const MessageView& message) {
+					auto [place, text, size] = message.getLCDData();
+					visitor.onLCD(place, text, size); };
+			}
+			else if constexpr (type == SysExMessage::VersionRequest
+				&& requires (Visitor& v) { v.onVersionRequest(); }) {
+				return [](Visitor& visitor, const MessageView&) { visitor.onVersionRequest(); };
+			}
+			else if constexpr (type == SysExMessage::VersionReply
+				&& requires (Visitor& v, const char* version, int size) { v.onVersionReply(version, size); }) {
+				return [](Visitor& visitor, const MessageView& message) {
+					auto [version, size] = message.getVersionReplyData();
+					visitor.onVersionReply(version, size); };
+			}
+			else if constexpr (type == SysExMessage::ChannelMeterMode
+				&& requires (Visitor& v, uint8_t a, uint8_t b) { v.onChannelMeterMode(a, b); }) {
+				return [](Visitor& visitor, const MessageView& message) {
+					auto [channel, mode] = message.getChannelMeterModeData();
+					visitor.onChannelMeterMode(channel, mode); };
+			}
+			else if constexpr (type == SysExMessage::GlobalLCDMeterMode
+				&& requires (Visitor& v, uint8_t a) { v.onGlobalLCDMeterMode(a); }) {
+				return [](Visitor& visitor, const MessageView& message) {
+					auto [mode] = message.getGlobalLCDMeterModeData();
+					visitor.onGlobalLCDMeterMode(mode); };
+			}
+			else if constexpr (type == SysExMessage::AllFaderstoMinimum
+				&& requires (Visitor& v) { v.onAllFaderstoMinimum(); }) {
+				return [](Visitor& visitor, const MessageView&) { visitor.onAllFaderstoMinimum(); };
+			}
+			else if constexpr (type == SysExMessage::AllLEDsOff
+				&& requires (Visitor& v) { v.onAllLEDsOff(); }) {
+				return [](Visitor& visitor, const MessageView&) { visitor.onAllLEDsOff(); };
+			}
+			else if constexpr (type == SysExMessage::Reset
+				&& requires (Visitor& v) { v.onReset(); }) {
+				return [](Visitor& visitor, const MessageView&) { visitor.onReset(); };
+			}
+			else if constexpr (requires (Visitor& v, const MessageView& m) { v.onSysEx(type, m); }) {
+				return [](Visitor& visitor, const MessageView& message) { visitor.onSysEx(type, message); };
+			}
+			else {
+				return nullptr;
+			}
+		}
+
+		template <std::size_t... I>
+		static constexpr std::array<Handler, 128> makeSysExTable(std::index_sequence<I...>) {
+			std::array<Handler, 128> result{};
+			((result[static_cast<uint8_t>(validSysExMessage[I])] = Dispatcher::getSysExHandler<validSysExMessage[I]>()), ...);
+			return result;
+		}
+
+		static constexpr std::array<Handler, 6> makeTypeTable() {
+			std::array<Handler, 6> result{};
+			if constexpr (requires (Visitor& v, const MessageView& m) { v.onInvalid(m); }) {
+				result[static_cast<uint8_t>(MessageType::Invalid)] =
+					[](Visitor& visitor, const MessageView& message) { visitor.onInvalid(message); };
+			}
+			if constexpr (requires (Visitor& v, NoteMessage type, VelocityMessage vel) { v.onNote(type, vel); }) {
+				result[static_cast<uint8_t>(MessageType::Note)] = [](Visitor& visitor, const MessageView& message) {
+					auto [type, vel] = message.getNoteData();
+					visitor.onNote(type, vel); };
+			}
+			if constexpr (requires (Visitor& v, CCMessage type, int value) { v.onCC(type, value); }) {
+				result[static_cast<uint8_t>(MessageType::CC)] = [](Visitor& visitor, const MessageView& message) {
+					auto [type, value] = message.getCCData();
+					visitor.onCC(type, value); };
+			}
+			if constexpr (requires (Visitor& v, int channel, int value) { v.onFader(channel, value); }) {
+				result[static_cast<uint8_t>(MessageType::PitchWheel)] = [](Visitor& visitor, const MessageView& message) {
+					auto [channel, value] = message.getPitchWheelData();
+					visitor.onFader(channel, value); };
+			}
+			if constexpr (requires (Visitor& v, int channel, int value) { v.onMeter(channel, value); }) {
+				result[static_cast<uint8_t>(MessageType::ChannelPressure)] = [](Visitor& visitor, const MessageView& message) {
+					auto [channel, value] = message.getChannelPressureData();
+					visitor.onMeter(channel, value); };
+			}
+			return result;
+		}
+
+		static constexpr std::array<Handler, 128> sysExTable =
+			Dispatcher::makeSysExTable(std::make_index_sequence<validSysExMessage.size()>{});
+		static constexpr std::array<Handler, 6> typeTable = Dispatcher::makeTypeTable();
+	};
+
+	/**
+	 * Pass the message to the typed handler of the visitor.
+	 * \param message		Message
+	 * \param visitor		Visitor with typed handlers (see Dispatcher)
+	 * \return	True if the visitor has a handler of the message
+	 */
+	template <typename Visitor>
+	bool dispatch(const MessageView& message, Visitor&& visitor) {
+		return Dispatcher<std::remove_reference_t<Visitor>>::dispatch(message, visitor);
+	}
+	/**
+	 * Pass the Mackie Control message to the typed handler of the visitor.
+	 * \param message		Message
+	 * \param visitor		Visitor with typed handlers (see Dispatcher)
+	 * \return	True if the visitor has a handler of the message
+	 */
+	template <typename Visitor>
+	bool dispatch(const Message& message, Visitor&& visitor) {
+		return Dispatcher<std::remove_reference_t<Visitor>>::dispatch(MessageView{ message }, visitor);
+	}
+}
@@ -0,0 +1,103 @@
+/*****************************************************************//**
+ * \file	EncoderAccumulator.cpp
+ * \brief	Accumulator coalescing V-Pot and jog wheel ticks into one delta per encoder.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ *********************************************************************/
+
+#include "EncoderAccumulator.h"
+
+namespace mackieControl {
+	/** Max seconds between two messages of an encoder to measure its rate. */
+	constexpr double maxRateGap = 0.1;
+	/** Min seconds between two messages of an encoder, so messages of one block don't give an infinite rate. */
+	constexpr double minRateGap = 0.001;
+
+	EncoderAccumulator::EncoderAccumulator(double flushInterval) {
+		this->setFlushInterval(flushInterval);
+	}
+
+	void EncoderAccumulator::setFlushInterval(double flushInterval) {
+		this->flushInterval = std::max(flushInterval, 0.0);
+	}
+
+	void EncoderAccumulator::setAcceleration(int encoder, const EncoderAcceleration& acceleration) {
+		if (encoder < 0 || encoder >= numEncoders) { return; }
+		this->encoders[encoder].acceleration = acceleration;
+	}
+
+	bool EncoderAccumulator::handleInput(const MessageView& message, double timeStamp) {
+		if (!message.isCC()) { return false; }
+
+		auto [type, value] = message.getCCData();
+		int cc = static_cast<int>(type);
+
+		int encoder = -1;
+		WheelType direction = WheelType::CW;
+		int ticks = 0;
+		if (cc >= static_cast<int>(CCMessage::VPot1) && cc <= static_cast<int>(CCMessage::VPot8)) {
+			encoder = cc - static_cast<int>(CCMessage::VPot1);
+			std::tie(direction, ticks) = Message::convertVPotValue(value);
+		}
+		else if (type == CCMessage::JogWheel) {
+			encoder = jogWheel;
+			std::tie(direction, ticks) = Message::convertJogWheelValue(value);
+		}
+		else {
+			return false;
+		}
+
+		this->add(encoder, (direction == WheelType::CW) ? ticks : -ticks, timeStamp);
+		return true;
+	}
+
+	void EncoderAccumulator::add(int encoder, int ticks, double timeStamp) {
+		if (encoder < 0 || encoder >= numEncoders || ticks == 0) { return; }
+
+		auto& state = this->encoders[encoder];
+		auto& acceleration = state.acceleration;
+
+		double factor = 1;
+		double gap = timeStamp - state.lastTime;
+		if (acceleration.maxFactor > 1 && state.lastTime >= 0 && gap >= 0 && gap <= maxRateGap) {
+			double rate = std::abs(ticks) / std::max(gap, minRateGap);
+			if (rate > acceleration.threshold) {
+				factor = std::min(1 + acceleration.sensitivity * (rate - acceleration.threshold), acceleration.maxFactor);
+			}
+		}
+
+		state.accumulated += ticks * factor;
+		state.lastTime = timeStamp;
+		this->numEvents++;
+	}
+
+	int EncoderAccumulator::getDelta(int encoder) const {
+		if (encoder < 0 || encoder >= numEncoders) { return 0; }
+		return static_cast<int>(this->encoders[encoder].accumulated);
+	}
+
+	void EncoderAccumulator::clear() {
+		for (auto& state : this->encoders) {
+			state.accumulated = 0;
+		}
+	}
+
+	uint64_t EncoderAccumulator::getNumEvents() const {
+		return this->numEvents;
+	}
+
+	uint64_t EncoderAccumulator::getNumDelivered() const {
+		return this->numDelivered;
+	}
+
+	int EncoderAccumulator::takeDelta(int encoder) {
+		// Truncate towards 0 and keep the fractional part
+		auto& state = this->encoders[encoder];
+		int delta = static_cast<int>(state.accumulated);
+		state.accumulated -= delta;
+		return delta;
+	}
+}
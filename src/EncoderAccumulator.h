@@ -0,0 +1,142 @@
+﻿/*****************************************************************//**
+ * \file	EncoderAccumulator.h
+ * \brief	Accumulator coalescing V-Pot and jog wheel ticks into one delta per encoder.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ *********************************************************************/
+
+#pragma once
+
+#include "MessageView.h"
+
+namespace mackieControl {
+	/**
+	 * Velocity-based acceleration of an encoder.
+	 * Ticks turned faster than the threshold are multiplied by 1 + sensitivity * (rate - threshold), up to the max factor.
+	 */
+	struct MACKIE_API EncoderAcceleration final {
+		/** Rate in ticks per second above which ticks are accelerated */
+		double threshold = 0;
+		/** Factor added per tick per second above the threshold */
+		double sensitivity = 0;
+		/** Max factor, 1 for no acceleration */
+		double maxFactor = 1;
+	};
+
+	/**
+	 * Sums the signed ticks of the relative encoders (V-Pot 1-8 and the jog wheel) and delivers
+	 * one delta per encoder on each flush, so the rate of host callbacks is bounded by the flush rate
+	 * however fast the encoders turn. Clockwise ticks are positive.
+	 * Accelerated deltas keep their fractional part for the next flush, so no tick is lost to rounding.
+	 */
+	class MACKIE_API EncoderAccumulator final {
+	public:
+		/** Count of encoders, V-Pot 1-8 are encoders 0-7. */
+		static constexpr int numEncoders = 9;
+		/** Encoder index of the jog wheel. */
+		static constexpr int jogWheel = 8;
+
+		/**
+		 * Create an encoder accumulator.
+		 * \param flushInterval	Min seconds between two timed flushes
+		 */
+		explicit EncoderAccumulator(double flushInterval = 0.02);
+
+		/**
+		 * Set the min seconds between two timed flushes.
+		 */
+		void setFlushInterval(double flushInterval);
+		/**
+		 * Set the acceleration of an encoder.
+		 * \param encoder		Encoder Index
+		 * \param acceleration	Acceleration
+		 */
+		void setAcceleration(int encoder, const EncoderAcceleration& acceleration);
+
+		/**
+		 * Accumulate a V-Pot or jog wheel message.
+		 * \param message		Message
+		 * \param timeStamp		Time Stamp in Seconds
+		 * \return	True if the message belongs to an encoder
+		 */
+		bool handleInput(const MessageView& message, double timeStamp);
+		/**
+		 * Accumulate ticks of an encoder.
+		 * \param encoder		Encoder Index
+		 * \param ticks			Signed Ticks, clockwise is positive
+		 * \param timeStamp		Time Stamp in Seconds
+		 */
+		void add(int encoder, int ticks, double timeStamp);
+
+		/**
+		 * Get the accumulated delta of an encoder which the next flush delivers.
+		 * \param encoder		Encoder Index
+		 */
+		int getDelta(int encoder) const;
+		/**
+		 * Drop all accumulated ticks.
+		 */
+		void clear();
+
+		/**
+		 * Pass the accumulated delta of each encoder with ticks to the handler, then clear them.
+		 * \param handler		void(int encoder, int delta)
+		 * \return	Count of delivered deltas
+		 */
+		template <typename Handler>
+		int flush(Handler&& handler) {
+			int count = 0;
+			for (int i = 0; i < numEncoders; i++) {
+				int delta = this->takeDelta(i);
+				if (delta == 0) { continue; }
+
+				handler(i, delta);
+				count++;
+			}
+
+			this->numDelivered += count;
+			return count;
+		}
+		/**
+		 * Flush if the flush interval has passed since the last timed flush.
+		 * \param currentTime	Current Time in Seconds
+		 * \param handler		void(int encoder, int delta)
+		 * \return	Count of delivered deltas
+		 */
+		template <typename Handler>
+		int flush(double currentTime, Handler&& handler) {
+			if (currentTime - this->lastFlushTime < this->flushInterval) { return 0; }
+
+			this->lastFlushTime = currentTime;
+			return this->flush(std::forward<Handler>(handler));
+		}
+
+		/**
+		 * Get the count of accumulated encoder messages.
+		 */
+		uint64_t getNumEvents() const;
+		/**
+		 * Get the count of delivered deltas.
+		 */
+		uint64_t getNumDelivered() const;
+
+	private:
+		struct Encoder final {
+			EncoderAcceleration acceleration;
+			double accumulated = 0;
+			double lastTime = -1;
+		};
+
+		std::array<Encoder, numEncoders> encoders;
+		double flushInterval = 0.02;
+		double lastFlushTime = -std::numeric_limits<double>::infinity();
+		uint64_t numEvents = 0, numDelivered = 0;
+
+		int takeDelta(int encoder);
+
+		JUCE_LEAK_DETECTOR(EncoderAccumulator)
+	};
+}
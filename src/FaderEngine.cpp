@@ -0,0 +1,138 @@
+/*****************************************************************//**
+ * \file	FaderEngine.cpp
+ * \brief	Touch-aware motor fader feedback with echo suppression.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ *********************************************************************/
+
+#include "FaderEngine.h"
+
+namespace mackieControl {
+	FaderEngine::FaderEngine(double maxUpdateRate, double echoWindow, int echoTolerance) {
+		this->setMaxUpdateRate(maxUpdateRate);
+		this->setEchoWindow(echoWindow);
+		this->setEchoTolerance(echoTolerance);
+		this->invalidate();
+	}
+
+	void FaderEngine::setMaxUpdateRate(double maxUpdateRate) {
+		this->minInterval = (maxUpdateRate > 0) ? (1.0 / maxUpdateRate) : 0;
+	}
+
+	void FaderEngine::setEchoWindow(double echoWindow) {
+		this->echoWindow = echoWindow;
+	}
+
+	void FaderEngine::setEchoTolerance(int echoTolerance) {
+		this->echoTolerance = std::max(echoTolerance, 0);
+	}
+
+	std::tuple<FaderInputType, int, int> FaderEngine::handleInput(const MessageView& message, double currentTime) {
+		switch (message.getType()) {
+		case MessageType::Note: {
+			auto [type, vel] = message.getNoteData();
+			int note = static_cast<int>(type);
+			if (note < static_cast<int>(NoteMessage::FaderTouchCh1) || note > static_cast<int>(NoteMessage::FaderTouchMaster)) {
+				return { FaderInputType::Ignored, 0, 0 };
+			}
+
+			int channel = note - static_cast<int>(NoteMessage::FaderTouchCh1) + 1;
+			auto& state = this->channels[channel - 1];
+			state.touched = (vel != VelocityMessage::Off);
+			return { state.touched ? FaderInputType::Touch : FaderInputType::Release, channel, state.position };
+		}
+		case MessageType::PitchWheel: {
+			auto [channel, value] = message.getPitchWheelData();
+			auto& state = this->channels[channel - 1];
+			if (this->isEcho(state, value, currentTime)) {
+				this->numEchoesDropped++;
+				return { FaderInputType::Echo, channel, value };
+			}
+
+			// A touched fader is moved by the user, so its new position is also the wanted one.
+			// Otherwise the motor would pull the fader back to the old position on release.
+			state.surfacePosition = value;
+			if (state.touched) {
+				state.position = value;
+			}
+			return { FaderInputType::Move, channel, value };
+		}
+		default:
+			return { FaderInputType::Ignored, 0, 0 };
+		}
+	}
+
+	void FaderEngine::setPosition(int channel, int value) {
+		if (channel < 1 || channel > numFaders) { return; }
+
+		auto& state = this->channels[channel - 1];
+		value = juce::jlimit(0, 16383, value);
+		if (state.touched && value != state.position) {
+			this->numTouchHeld++;
+		}
+		state.position = value;
+	}
+
+	int FaderEngine::getPosition(int channel) const {
+		if (channel < 1 || channel > numFaders) { return 0; }
+		return this->channels[channel - 1].position;
+	}
+
+	bool FaderEngine::isTouched(int channel) const {
+		if (channel < 1 || channel > numFaders) { return false; }
+		return this->channels[channel - 1].touched;
+	}
+
+	int FaderEngine::process(double currentTime, juce::MidiBuffer& buffer, int samplePosition) {
+		int count = 0;
+		for (int i = 0; i < numFaders; i++) {
+			auto& state = this->channels[i];
+			if (state.touched || state.position == state.surfacePosition) { continue; }
+			if (state.lastSendTime >= 0 && currentTime - state.lastSendTime < this->minInterval) { continue; }
+
+			uint8_t bytes[3] = { static_cast<uint8_t>(0xE0 | i),
+				static_cast<uint8_t>(state.position & 0x7F), static_cast<uint8_t>((state.position >> 7) & 0x7F) };
+			buffer.addEvent(bytes, sizeof(bytes), samplePosition);
+
+			state.surfacePosition = state.position;
+			state.lastSendTime = currentTime;
+			state.echoValues[state.echoIndex] = state.position;
+			state.echoTimes[state.echoIndex] = currentTime;
+			state.echoIndex = (state.echoIndex + 1) % numEchoes;
+			count++;
+		}
+		return count;
+	}
+
+	void FaderEngine::invalidate() {
+		for (auto& state : this->channels) {
+			state.surfacePosition = -1;
+			state.lastSendTime = -1;
+			state.echoValues.fill(-1);
+			state.echoTimes.fill(-1);
+			state.echoIndex = 0;
+		}
+	}
+
+	uint64_t FaderEngine::getNumEchoesDropped() const {
+		return this->numEchoesDropped;
+	}
+
+	uint64_t FaderEngine::getNumTouchHeld() const {
+		return this->numTouchHeld;
+	}
+
+	bool FaderEngine::isEcho(const Channel& channel, int value, double currentTime) const {
+		if (channel.touched) { return false; }
+
+		for (int i = 0; i < numEchoes; i++) {
+			if (channel.echoValues[i] < 0) { continue; }
+			if (currentTime - channel.echoTimes[i] > this->echoWindow) { continue; }
+			if (std::abs(channel.echoValues[i] - value) <= this->echoTolerance) { return true; }
+		}
+		return false;
+	}
+}
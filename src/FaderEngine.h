@@ -0,0 +1,131 @@
+﻿/*****************************************************************//**
+ * \file	FaderEngine.h
+ * \brief	Touch-aware motor fader feedback with echo suppression.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ *********************************************************************/
+
+#pragma once
+
+#include "MessageView.h"
+
+namespace mackieControl {
+	/**
+	 * Result of an inbound message handled by the fader engine.
+	 */
+	enum class MACKIE_API FaderInputType {
+		Ignored,
+		Touch,
+		Release,
+		Move,
+		Echo
+	};
+
+	/**
+	 * Motor fader feedback engine for the nine fader channels (1-8 and the master channel).
+	 * Holds the outbound position while a fader is touched, drops inbound positions which echo a recently sent one,
+	 * and rate-limits motor updates with the latest value winning.
+	 * A move of a touched fader also becomes the wanted position, so the fader stays where it's released
+	 * even if the host doesn't set the moved position back.
+	 */
+	class MACKIE_API FaderEngine final {
+	public:
+		/** Count of fader channels. */
+		static constexpr int numFaders = 9;
+		/** Count of sent positions remembered for echo suppression on each channel. */
+		static constexpr int numEchoes = 4;
+
+		/**
+		 * Create a fader engine.
+		 * \param maxUpdateRate	Max motor updates of each fader (Hz)
+		 * \param echoWindow	Time of a sent position to be treated as echo (s)
+		 * \param echoTolerance	Max difference of an inbound position to match an echo
+		 */
+		explicit FaderEngine(double maxUpdateRate = 50.0, double echoWindow = 0.25, int echoTolerance = 0);
+
+		/**
+		 * Set the max motor updates of each fader (Hz).
+		 */
+		void setMaxUpdateRate(double maxUpdateRate);
+		/**
+		 * Set the time of a sent position to be treated as echo (s).
+		 */
+		void setEchoWindow(double echoWindow);
+		/**
+		 * Set the max difference of an inbound position to match an echo.
+		 */
+		void setEchoTolerance(int echoTolerance);
+
+		/**
+		 * Handle an inbound message from the surface.
+		 * \param message		Message
+		 * \param currentTime	Current Time (s)
+		 * \return	Input Type, Channel Number, Fader Value
+		 */
+		std::tuple<FaderInputType, int, int> handleInput(const MessageView& message, double currentTime);
+
+		/**
+		 * Set the fader position wanted by the host.
+		 * \param channel		Channel Number (1-9)
+		 * \param value			Fader Value
+		 */
+		void setPosition(int channel, int value);
+		/**
+		 * Get the fader position wanted by the host.
+		 * \param channel		Channel Number (1-9)
+		 */
+		int getPosition(int channel) const;
+		/**
+		 * Check if the fader is touched.
+		 * \param channel		Channel Number (1-9)
+		 */
+		bool isTouched(int channel) const;
+
+		/**
+		 * Append motor updates which are due to the MIDI buffer.
+		 * \param currentTime	Current Time (s)
+		 * \param buffer		MIDI Buffer
+		 * \param samplePosition	Sample Position
+		 * \return	Count of motor updates
+		 */
+		int process(double currentTime, juce::MidiBuffer& buffer, int samplePosition = 0);
+		/**
+		 * Forget the surface state, so every fader is sent again.
+		 */
+		void invalidate();
+
+		/**
+		 * Get the count of inbound positions dropped as echoes.
+		 */
+		uint64_t getNumEchoesDropped() const;
+		/**
+		 * Get the count of outbound updates held because the fader was touched.
+		 */
+		uint64_t getNumTouchHeld() const;
+
+	private:
+		struct Channel final {
+			int position = 0;
+			int surfacePosition = -1;
+			bool touched = false;
+			double lastSendTime = -1;
+
+			std::array<int, numEchoes> echoValues;
+			std::array<double, numEchoes> echoTimes;
+			int echoIndex = 0;
+		};
+
+		std::array<Channel, numFaders> channels;
+		double minInterval = 0, echoWindow = 0;
+		int echoTolerance = 0;
+
+		uint64_t numEchoesDropped = 0, numTouchHeld = 0;
+
+		bool isEcho(const Channel& channel, int value, double currentTime) const;
+
+		JUCE_LEAK_DETECTOR(FaderEngine)
+	};
+}
@@ -0,0 +1,166 @@
+/*****************************************************************//**
+ * \file	FaderLaw.cpp
+ * \brief	Table-driven conversion between fader values and gains.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ *********************************************************************/
+
+#include "FaderLaw.h"
+
+namespace mackieControl {
+	/** Difference below which the smoothed gain snaps to the target. */
+	constexpr float smoothingEpsilon = 1e-6f;
+
+	/** Breakpoints of the Logic Control fader scale. */
+	constexpr std::array<FaderBreakpoint, 10> logicBreakpoints = { {
+		{ 0.f, FaderLaw::minusInfinityDecibels }, { 0.05f, -60.f }, { 0.15f, -40.f }, { 0.25f, -30.f },
+		{ 0.4f, -20.f }, { 0.55f, -10.f }, { 0.65f, -5.f }, { 0.75f, 0.f }, { 0.875f, 3.f }, { 1.f, 6.f } } };
+
+	FaderLaw::FaderLaw(const std::function<float(float)>& curve) {
+		this->gains.resize(numValues);
+
+		// The inverse search needs a non-decreasing table
+		float last = 0.f;
+		for (int i = 0; i < numValues; i++) {
+			float gain = curve ? curve(static_cast<float>(i) / (numValues - 1)) : 0.f;
+			last = std::max(last, std::isfinite(gain) ? gain : 0.f);
+			this->gains[i] = last;
+		}
+	}
+
+	FaderLaw FaderLaw::createLinearDecibels(float minDecibels, float maxDecibels) {
+		return FaderLaw{ [minDecibels, maxDecibels](float position) {
+			if (position <= 0) { return 0.f; }
+			return juce::Decibels::decibelsToGain(minDecibels + (maxDecibels - minDecibels) * position, minusInfinityDecibels);
+			} };
+	}
+
+	FaderLaw FaderLaw::createLogic() {
+		return FaderLaw::createBreakpoints(logicBreakpoints);
+	}
+
+	FaderLaw FaderLaw::createBreakpoints(std::span<const FaderBreakpoint> breakpoints) {
+		std::vector<FaderBreakpoint> points{ breakpoints.begin(), breakpoints.end() };
+		return FaderLaw{ [points = std::move(points)](float position) {
+			if (points.empty()) { return 0.f; }
+
+			auto next = std::upper_bound(points.begin(), points.end(), position,
+				[](float position, const FaderBreakpoint& point) { return position < point.position; });
+
+			float decibels = 0;
+			if (next == points.begin()) { decibels = next->decibels; }
+			else if (next == points.end()) { decibels = points.back().decibels; }
+			else {
+				auto& prev = *(next - 1);
+				float width = next->position - prev.position;
+				float ratio = (width > 0) ? ((position - prev.position) / width) : 1.f;
+				decibels = prev.decibels + (next->decibels - prev.decibels) * ratio;
+			}
+
+			return juce::Decibels::decibelsToGain(decibels, minusInfinityDecibels);
+			} };
+	}
+
+	float FaderLaw::toGain(int value) const {
+		return this->gains[juce::jlimit(0, numValues - 1, value)];
+	}
+
+	int FaderLaw::toValue(float gain) const {
+		// Branchless search of the last value with a gain below the target, so flat parts of the curve map to their lowest value
+		const float* table = this->gains.data();
+		int base = 0;
+		for (int size = numValues; size > 1; size -= size / 2) {
+			int half = size / 2;
+			base = (table[base + half] < gain) ? (base + half) : base;
+		}
+
+		if (table[base] < gain && base < numValues - 1 && (table[base + 1] - gain) <= (gain - table[base])) {
+			base++;
+		}
+		return base;
+	}
+
+	float FaderLaw::toDecibels(int value) const {
+		return juce::Decibels::gainToDecibels(this->toGain(value), minusInfinityDecibels);
+	}
+
+	int FaderLaw::fromDecibels(float decibels) const {
+		return this->toValue(juce::Decibels::decibelsToGain(decibels, minusInfinityDecibels));
+	}
+
+	int FaderLaw::toGain(std::span<const int> values, std::span<float> dest) const {
+		int size = static_cast<int>(std::min(values.size(), dest.size()));
+		for (int i = 0; i < size; i++) {
+			dest[i] = this->toGain(values[i]);
+		}
+		return size;
+	}
+
+	int FaderLaw::toValue(std::span<const float> gains, std::span<int> dest) const {
+		// The searches are independent, so the CPU overlaps their loads
+		int size = static_cast<int>(std::min(gains.size(), dest.size()));
+		for (int i = 0; i < size; i++) {
+			dest[i] = this->toValue(gains[i]);
+		}
+		return size;
+	}
+
+	GainSmoother::GainSmoother(double time, double sampleRate, float gain) {
+		this->setTime(time, sampleRate);
+		this->reset(gain);
+	}
+
+	void GainSmoother::setTime(double time, double sampleRate) {
+		double samples = time * sampleRate;
+		this->coefficient = (samples > 0) ? static_cast<float>(std::exp(-1.0 / samples)) : 0.f;
+	}
+
+	void GainSmoother::setTarget(float gain) {
+		this->target = gain;
+	}
+
+	void GainSmoother::reset(float gain) {
+		this->current = this->target = gain;
+	}
+
+	float GainSmoother::getCurrent() const {
+		return this->current;
+	}
+
+	bool GainSmoother::isSmoothing() const {
+		return this->current != this->target;
+	}
+
+	void GainSmoother::process(std::span<float> dest) {
+		this->processTo(static_cast<int>(dest.size()), [dest](int index, float gain) {
+			dest[index] = gain;
+			});
+	}
+
+	void GainSmoother::apply(std::span<float> samples) {
+		this->processTo(static_cast<int>(samples.size()), [samples](int index, float gain) {
+			samples[index] *= gain;
+			});
+	}
+
+	template <typename Writer>
+	void GainSmoother::processTo(int size, Writer&& writer) {
+		int i = 0;
+		float value = this->current, target = this->target, coefficient = this->coefficient;
+		for (; i < size && value != target; i++) {
+			value = target + coefficient * (value - target);
+			if (std::abs(value - target) < smoothingEpsilon) { value = target; }
+			writer(i, value);
+		}
+
+		// The rest of the block is constant
+		for (; i < size; i++) {
+			writer(i, target);
+		}
+
+		this->current = value;
+	}
+}
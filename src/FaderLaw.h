@@ -0,0 +1,158 @@
+﻿/*****************************************************************//**
+ * \file	FaderLaw.h
+ * \brief	Table-driven conversion between fader values and gains.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ *********************************************************************/
+
+#pragma once
+
+#include <functional>
+
+#include "MackieControl.h"
+
+namespace mackieControl {
+	/**
+	 * Point of a fader curve.
+	 */
+	struct MACKIE_API FaderBreakpoint final {
+		/** Fader Position (0-1) */
+		float position = 0;
+		/** Gain in dB, values at or below -100 dB are silence */
+		float decibels = 0;
+	};
+
+	/**
+	 * Conversion between 14-bit fader values (0-16383) and linear gains by a curve.
+	 * The curve is sampled once into a table of every fader value, so value to gain is one lookup
+	 * and gain to value is a branchless binary search of the table, without transcendental math per event.
+	 */
+	class MACKIE_API FaderLaw final {
+	public:
+		/** Count of fader values. */
+		static constexpr int numValues = 16384;
+		/** Gain in dB treated as silence. */
+		static constexpr float minusInfinityDecibels = -100.f;
+
+		/**
+		 * Create a fader law from a curve.
+		 * \param curve			float(float position) returning the gain of a fader position (0-1), made monotonic
+		 */
+		explicit FaderLaw(const std::function<float(float)>& curve);
+
+		/**
+		 * Create a fader law linear in dB. Fader value 0 is silence.
+		 * \param minDecibels	Gain of the lowest position above 0 in dB
+		 * \param maxDecibels	Gain of the highest position in dB
+		 */
+		static FaderLaw createLinearDecibels(float minDecibels = -72.f, float maxDecibels = 6.f);
+		/**
+		 * Create a fader law approximating the scale printed on the Logic Control faders (-inf to +6 dB, 0 dB at 3/4).
+		 */
+		static FaderLaw createLogic();
+		/**
+		 * Create a fader law interpolating linearly in dB between breakpoints.
+		 * \param breakpoints	Breakpoints sorted by position
+		 */
+		static FaderLaw createBreakpoints(std::span<const FaderBreakpoint> breakpoints);
+
+		/**
+		 * Convert a fader value to gain.
+		 * \param value			Fader Value
+		 */
+		float toGain(int value) const;
+		/**
+		 * Convert a gain to the nearest fader value.
+		 * \param gain			Gain
+		 */
+		int toValue(float gain) const;
+		/**
+		 * Convert a fader value to gain in dB.
+		 */
+		float toDecibels(int value) const;
+		/**
+		 * Convert a gain in dB to the nearest fader value.
+		 */
+		int fromDecibels(float decibels) const;
+
+		/**
+		 * Convert a block of fader values to gains.
+		 * \param values		Fader Values
+		 * \param dest			Gains
+		 * \return	Count of converted values, the smaller size of values and dest
+		 */
+		int toGain(std::span<const int> values, std::span<float> dest) const;
+		/**
+		 * Convert a block of gains to the nearest fader values.
+		 * \param gains			Gains
+		 * \param dest			Fader Values
+		 * \return	Count of converted gains, the smaller size of gains and dest
+		 */
+		int toValue(std::span<const float> gains, std::span<int> dest) const;
+
+	private:
+		std::vector<float> gains;
+
+		JUCE_LEAK_DETECTOR(FaderLaw)
+	};
+
+	/**
+	 * One-pole smoother of gains for audio-rate ramps following the fader.
+	 */
+	class MACKIE_API GainSmoother final {
+	public:
+		/**
+		 * Create a gain smoother.
+		 * \param time			Time constant in seconds, 0 for no smoothing
+		 * \param sampleRate	Sample Rate
+		 * \param gain			Initial Gain
+		 */
+		explicit GainSmoother(double time = 0.02, double sampleRate = 48000.0, float gain = 0.f);
+
+		/**
+		 * Set the time constant.
+		 * \param time			Time constant in seconds, 0 for no smoothing
+		 * \param sampleRate	Sample Rate
+		 */
+		void setTime(double time, double sampleRate);
+		/**
+		 * Set the gain the smoother moves towards.
+		 */
+		void setTarget(float gain);
+		/**
+		 * Jump to a gain at once.
+		 */
+		void reset(float gain);
+		/**
+		 * Get the current gain.
+		 */
+		float getCurrent() const;
+		/**
+		 * Check if the current gain is still moving towards the target.
+		 */
+		bool isSmoothing() const;
+
+		/**
+		 * Write the gain of each sample of a block.
+		 * \param dest			Gains
+		 */
+		void process(std::span<float> dest);
+		/**
+		 * Multiply a block of samples by the gain of each sample.
+		 * \param samples		Samples
+		 */
+		void apply(std::span<float> samples);
+
+	private:
+		float coefficient = 0;
+		float current = 0, target = 0;
+
+		template <typename Writer>
+		void processTo(int size, Writer&& writer);
+
+		JUCE_LEAK_DETECTOR(GainSmoother)
+	};
+}
@@ -0,0 +1,191 @@
+/*****************************************************************//**
+ * \file	HostConnection.cpp
+ * \brief	Non-blocking host connection handshake of Mackie Control surfaces.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ *********************************************************************/
+
+#include "HostConnection.h"
+#include "StaticMessage.h"
+
+namespace mackieControl {
+	HostConnection::HostConnection(double timeout, int maxRetries)
+		: timeout(timeout), maxRetries(std::max(maxRetries, 0)) {}
+
+	void HostConnection::setResponseFunction(ResponseFunction function) {
+		this->responseFunction = function ? function : &HostConnection::computeResponse;
+	}
+
+	uint32_t HostConnection::computeResponse(uint32_t challenge) {
+		// The code is stored in the same byte order as Message::createHostConnectionQuery
+		uint8_t c[4], r[4];
+		std::memcpy(c, &challenge, sizeof(c));
+
+		r[0] = 0x7F & (c[0] + (c[1] ^ 0xA) - c[3]);
+		r[1] = 0x7F & ((c[2] >> 4) ^ (c[0] + c[3]));
+		r[2] = 0x7F & ((c[3] - (c[2] << 2)) ^ (c[0] | c[1]));
+		r[3] = 0x7F & (c[1] - c[2] + (0xF0 ^ (c[3] << 4)));
+
+		uint32_t response;
+		std::memcpy(&response, r, sizeof(response));
+		return response;
+	}
+
+	void HostConnection::connect(double currentTime) {
+		this->retries = 0;
+		this->sendDeviceQuery(currentTime);
+	}
+
+	void HostConnection::disconnect() {
+		constexpr auto bytes = make<SysExMessage::GoOffline>();
+		std::copy(bytes.begin(), bytes.end(), this->pending.begin());
+		this->pendingSize = static_cast<int>(bytes.size());
+
+		if (this->state != ConnectionState::Offline) {
+			this->state = ConnectionState::Offline;
+			if (this->onOffline) { this->onOffline(); }
+		}
+	}
+
+	bool HostConnection::handleInput(const MessageView& message, double currentTime) {
+		if (!message.isSysEx()) { return false; }
+
+		switch (std::get<0>(message.getSysExData())) {
+		case SysExMessage::HostConnectionQuery: {
+			auto [serial, challenge] = message.getHostConnectionQueryData();
+
+			// Unknown surfaces are only answered after a device query
+			if (this->state == ConnectionState::Offline && !this->isKnownSerial(serial)) { return true; }
+
+			this->sendReply(serial, challenge, currentTime);
+			return true;
+		}
+		case SysExMessage::HostConnectionConfirmation: {
+			auto [serial] = message.getHostConnectionConfirmationData();
+			if (this->state != ConnectionState::Replied || serial != this->serial) { return true; }
+
+			bool known = this->isKnownSerial(serial);
+			this->addKnownSerial(serial);
+			this->state = ConnectionState::Connected;
+			this->retries = 0;
+
+			if (this->onResync) { this->onResync(serial, known); }
+			return true;
+		}
+		case SysExMessage::HostConnectionError: {
+			auto [serial] = message.getHostConnectionErrorData();
+			if (this->state != ConnectionState::Replied || serial != this->serial) { return true; }
+
+			this->numErrors++;
+			this->retry(currentTime);
+			return true;
+		}
+		default:
+			return false;
+		}
+	}
+
+	int HostConnection::tick(double currentTime, juce::MidiBuffer& buffer, int samplePosition) {
+		return this->tickTo(currentTime, [&buffer, samplePosition](const uint8_t* data, int size) {
+			return buffer.addEvent(data, size, samplePosition);
+			});
+	}
+
+	int HostConnection::tick(double currentTime, std::span<uint8_t> dest) {
+		return this->tickTo(currentTime, [dest](const uint8_t* data, int size) {
+			if (size > static_cast<int>(dest.size())) { return false; }
+			std::memcpy(dest.data(), data, size);
+			return true;
+			});
+	}
+
+	ConnectionState HostConnection::getState() const {
+		return this->state;
+	}
+
+	bool HostConnection::isConnected() const {
+		return this->state == ConnectionState::Connected;
+	}
+
+	const HostConnection::Serial& HostConnection::getSerial() const {
+		return this->serial;
+	}
+
+	bool HostConnection::isKnownSerial(const Serial& serial) const {
+		for (int i = 0; i < this->numKnownSerials; i++) {
+			if (this->knownSerials[i] == serial) { return true; }
+		}
+		return false;
+	}
+
+	uint64_t HostConnection::getNumRetries() const {
+		return this->numRetries;
+	}
+
+	uint64_t HostConnection::getNumErrors() const {
+		return this->numErrors;
+	}
+
+	void HostConnection::sendDeviceQuery(double currentTime) {
+		constexpr auto bytes = make<SysExMessage::DeviceQuery>();
+		std::copy(bytes.begin(), bytes.end(), this->pending.begin());
+		this->pendingSize = static_cast<int>(bytes.size());
+
+		this->state = ConnectionState::Querying;
+		this->deadline = currentTime + this->timeout;
+	}
+
+	void HostConnection::sendReply(const Serial& serial, uint32_t challenge, double currentTime) {
+		uint32_t response = this->responseFunction(challenge);
+
+		auto& bytes = this->pending;
+		bytes[0] = 0xF0;
+		std::memset(&bytes[1], 0, 4);
+		bytes[1 + 4] = static_cast<uint8_t>(SysExMessage::HostConnectionReply);
+		std::memcpy(&bytes[1 + 5], serial.data(), serial.size());
+		std::memcpy(&bytes[1 + 5 + serial.size()], &response, sizeof(response));
+		bytes[bytes.size() - 1] = 0xF7;
+		this->pendingSize = static_cast<int>(bytes.size());
+
+		this->serial = serial;
+		this->state = ConnectionState::Replied;
+		this->deadline = currentTime + this->timeout;
+	}
+
+	void HostConnection::retry(double currentTime) {
+		this->numRetries++;
+		if (++(this->retries) > this->maxRetries) {
+			this->disconnect();
+			return;
+		}
+
+		this->sendDeviceQuery(currentTime);
+	}
+
+	void HostConnection::addKnownSerial(const Serial& serial) {
+		if (this->isKnownSerial(serial)) { return; }
+
+		// Replace the oldest serial number when the cache is full
+		this->knownSerials[this->nextKnownSerial] = serial;
+		this->nextKnownSerial = (this->nextKnownSerial + 1) % maxKnownSerials;
+		this->numKnownSerials = std::min(this->numKnownSerials + 1, maxKnownSerials);
+	}
+
+	template <typename Writer>
+	int HostConnection::tickTo(double currentTime, Writer&& writer) {
+		bool waiting = (this->state == ConnectionState::Querying) || (this->state == ConnectionState::Replied);
+		if (waiting && currentTime >= this->deadline) {
+			this->retry(currentTime);
+		}
+
+		if (this->pendingSize == 0) { return 0; }
+		if (!writer(this->pending.data(), this->pendingSize)) { return 0; }
+
+		int size = this->pendingSize;
+		this->pendingSize = 0;
+		return size;
+	}
+}
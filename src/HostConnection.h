@@ -0,0 +1,161 @@
+﻿/*****************************************************************//**
+ * \file	HostConnection.h
+ * \brief	Non-blocking host connection handshake of Mackie Control surfaces.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ *********************************************************************/
+
+#pragma once
+
+#include <functional>
+
+#include "MessageView.h"
+
+namespace mackieControl {
+	/**
+	 * State of the host connection handshake.
+	 */
+	enum class MACKIE_API ConnectionState {
+		Offline,
+		Querying,
+		Replied,
+		Connected
+	};
+
+	/**
+	 * Host side of the Mackie Control connection handshake.
+	 * The host sends a device query, the surface sends a host connection query with its serial number and
+	 * a challenge code, the host replies with the response code and the surface confirms or rejects it.
+	 * The state machine is driven by handleInput() and tick() and never blocks. It keeps no dynamic state of its own,
+	 * but onResync and onOffline are called on the driving thread, so on a realtime thread they must not block or allocate either.
+	 * Serial numbers of confirmed surfaces are cached, so a known surface which sends a host connection query
+	 * while offline (e.g. after a power cycle) is answered at once without waiting for a device query.
+	 */
+	class MACKIE_API HostConnection final {
+	public:
+		/** Serial number of a surface. */
+		using Serial = std::array<uint8_t, 7>;
+		/** Function computing the response code of a challenge code. */
+		using ResponseFunction = uint32_t (*)(uint32_t challenge);
+
+		/** Max count of cached serial numbers. */
+		static constexpr int maxKnownSerials = 16;
+
+		/**
+		 * Create a host connection.
+		 * \param timeout		Seconds to wait for each answer of the surface
+		 * \param maxRetries	Count of retries before going offline
+		 */
+		explicit HostConnection(double timeout = 1.0, int maxRetries = 3);
+
+		/**
+		 * Set the function computing the response code of a challenge code.
+		 */
+		void setResponseFunction(ResponseFunction function);
+		/**
+		 * Compute the response code of a challenge code with the Mackie Control algorithm.
+		 */
+		static uint32_t computeResponse(uint32_t challenge);
+
+		/**
+		 * Start the handshake by sending a device query on the next tick.
+		 */
+		void connect(double currentTime);
+		/**
+		 * Send go offline on the next tick and stop the handshake.
+		 */
+		void disconnect();
+
+		/**
+		 * Handle a message of the surface.
+		 * \param message		Message
+		 * \param currentTime	Current Time in Seconds
+		 * \return	True if the message belongs to the handshake
+		 */
+		bool handleInput(const MessageView& message, double currentTime);
+		/**
+		 * Handle timeouts and append the pending handshake message to the MIDI buffer.
+		 * \param currentTime	Current Time in Seconds
+		 * \param buffer		MIDI Buffer
+		 * \param samplePosition	Sample Position
+		 * \return	Count of bytes emitted
+		 */
+		int tick(double currentTime, juce::MidiBuffer& buffer, int samplePosition = 0);
+		/**
+		 * Handle timeouts and write the pending handshake message into the buffer as raw MIDI bytes.
+		 * The message stays pending if it doesn't fit into the buffer.
+		 * \param currentTime	Current Time in Seconds
+		 * \param dest			Destination Buffer
+		 * \return	Count of bytes written
+		 */
+		int tick(double currentTime, std::span<uint8_t> dest);
+
+		/**
+		 * Get the handshake state.
+		 */
+		ConnectionState getState() const;
+		/**
+		 * Check if the surface confirmed the connection.
+		 */
+		bool isConnected() const;
+		/**
+		 * Get the serial number of the current surface.
+		 */
+		const Serial& getSerial() const;
+		/**
+		 * Check if the serial number belongs to a surface which was confirmed before.
+		 */
+		bool isKnownSerial(const Serial& serial) const;
+		/**
+		 * Get the count of retries.
+		 */
+		uint64_t getNumRetries() const;
+		/**
+		 * Get the count of handshakes rejected by the surface.
+		 */
+		uint64_t getNumErrors() const;
+
+		/**
+		 * Called when the surface confirmed the connection. The whole surface state should be resent.
+		 * The second argument is true if the surface was confirmed before.
+		 */
+		std::function<void(const Serial&, bool)> onResync;
+		/**
+		 * Called when the handshake gave up or the host disconnected.
+		 */
+		std::function<void()> onOffline;
+
+	private:
+		double timeout = 1.0;
+		int maxRetries = 3;
+		ResponseFunction responseFunction = &HostConnection::computeResponse;
+
+		ConnectionState state = ConnectionState::Offline;
+		Serial serial{};
+		double deadline = 0;
+		int retries = 0;
+
+		std::array<uint8_t, 1 + 5 + 7 + 4 + 1> pending{};
+		int pendingSize = 0;
+
+		std::array<Serial, maxKnownSerials> knownSerials{};
+		int numKnownSerials = 0;
+		int nextKnownSerial = 0;
+
+		uint64_t numRetries = 0;
+		uint64_t numErrors = 0;
+
+		void sendDeviceQuery(double currentTime);
+		void sendReply(const Serial& serial, uint32_t challenge, double currentTime);
+		void retry(double currentTime);
+		void addKnownSerial(const Serial& serial);
+
+		template <typename Writer>
+		int tickTo(double currentTime, Writer&& writer);
+
+		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(HostConnection)
+	};
+}
@@ -0,0 +1,118 @@
+/*****************************************************************//**
+ * \file	InboundQueue.cpp
+ * \brief	Wait-free single-producer/single-consumer queue of decoded Mackie Control events.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ *********************************************************************/
+
+#include "InboundQueue.h"
+
+namespace mackieControl {
+	/**
+	 * Increase a counter which is only written by the producer thread, without a locked instruction.
+	 */
+	static void increaseCounter(std::atomic<uint64_t>& counter) {
+		counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+	}
+
+	InboundQueue::InboundQueue(int capacity, int sysExCapacity)
+		: sysExCapacity(std::max(sysExCapacity, 0)) {
+		uint32_t size = 1;
+		while (size < static_cast<uint32_t>(std::max(capacity, 1))) {
+			size <<= 1;
+		}
+
+		this->events.resize(size);
+		this->payloads.resize(static_cast<std::size_t>(size) * this->sysExCapacity);
+		this->mask = size - 1;
+	}
+
+	bool InboundQueue::push(const MessageView& message, double timeStamp) {
+		auto type = message.getType();
+		if (type == MessageType::Invalid) {
+			increaseCounter(this->numInvalid);
+			return false;
+		}
+
+		auto data = message.getRawData();
+		if (type == MessageType::SysEx && static_cast<int>(data.size()) > this->sysExCapacity) {
+			increaseCounter(this->numOversized);
+			return false;
+		}
+
+		uint32_t head = this->head.load(std::memory_order_relaxed);
+		uint32_t tail = this->tail.load(std::memory_order_acquire);
+		if (head - tail > this->mask) {
+			increaseCounter(this->numOverflows);
+			return false;
+		}
+
+		uint32_t index = head & this->mask;
+		auto& event = this->events[index];
+		event.timeStamp = timeStamp;
+		event.size = static_cast<uint16_t>(data.size());
+		event.type = type;
+		if (type == MessageType::SysEx) {
+			event.bytes = { 0xF0, data[1 + 4], 0 };
+			std::memcpy(&(this->payloads[index * this->sysExCapacity]), data.data(), data.size());
+		}
+		else {
+			event.bytes = { data[0], data[1], (data.size() >= 3) ? data[2] : static_cast<uint8_t>(0) };
+			event.size = static_cast<uint16_t>(std::min<std::size_t>(data.size(), 3));
+		}
+
+		this->head.store(head + 1, std::memory_order_release);
+		return true;
+	}
+
+	bool InboundQueue::push(const juce::MidiMessage& message) {
+		return this->push(MessageView{ message.getRawData(), message.getRawDataSize() }, message.getTimeStamp());
+	}
+
+	int InboundQueue::push(const juce::MidiBuffer& buffer, double timeStamp, double sampleRate) {
+		int count = 0;
+		for (const auto metadata : buffer) {
+			double time = timeStamp + ((sampleRate > 0) ? (metadata.samplePosition / sampleRate) : 0);
+			if (this->push(MessageView{ metadata.data, metadata.numBytes }, time)) {
+				count++;
+			}
+		}
+		return count;
+	}
+
+	int InboundQueue::pop(std::span<InboundEvent> dest) {
+		uint32_t tail = this->tail.load(std::memory_order_relaxed);
+		uint32_t head = this->head.load(std::memory_order_acquire);
+		int count = static_cast<int>(std::min<std::size_t>(head - tail, dest.size()));
+
+		for (int i = 0; i < count; i++) {
+			dest[i] = this->events[(tail + i) & this->mask];
+		}
+
+		this->tail.store(tail + count, std::memory_order_release);
+		return count;
+	}
+
+	int InboundQueue::getNumQueued() const {
+		return static_cast<int>(this->head.load(std::memory_order_acquire) - this->tail.load(std::memory_order_acquire));
+	}
+
+	int InboundQueue::getCapacity() const {
+		return static_cast<int>(this->events.size());
+	}
+
+	uint64_t InboundQueue::getNumOverflows() const {
+		return this->numOverflows.load(std::memory_order_relaxed);
+	}
+
+	uint64_t InboundQueue::getNumOversized() const {
+		return this->numOversized.load(std::memory_order_relaxed);
+	}
+
+	uint64_t InboundQueue::getNumInvalid() const {
+		return this->numInvalid.load(std::memory_order_relaxed);
+	}
+}
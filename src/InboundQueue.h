@@ -0,0 +1,145 @@
+﻿/*****************************************************************//**
+ * \file	InboundQueue.h
+ * \brief	Wait-free single-producer/single-consumer queue of decoded Mackie Control events.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ *********************************************************************/
+
+#pragma once
+
+#include <atomic>
+
+#include "MessageView.h"
+
+namespace mackieControl {
+	/**
+	 * Decoded inbound Mackie Control event.
+	 * Short messages are stored inline. The bytes of MIDI system exclusive message are kept in the queue,
+	 * and only the message type is stored inline ({0xF0, type, 0}).
+	 */
+	struct MACKIE_API InboundEvent final {
+		/** Time Stamp */
+		double timeStamp = 0;
+		/** Raw MIDI Size */
+		uint16_t size = 0;
+		/** Message Type */
+		MessageType type = MessageType::Invalid;
+		/** Raw MIDI Bytes of short messages */
+		std::array<uint8_t, 3> bytes{};
+
+		/**
+		 * Get a view on the short message. MIDI system exclusive messages need the payload passed by InboundQueue::pop.
+		 */
+		MessageView getView() const {
+			return (this->type == MessageType::SysEx) ? MessageView{} : MessageView{ this->bytes.data(), this->size };
+		}
+	};
+
+	/**
+	 * Bounded wait-free single-producer/single-consumer queue of decoded Mackie Control events.
+	 * All memory is allocated on construction. Pushing never allocates or locks, so it is safe on the MIDI input thread.
+	 */
+	class MACKIE_API InboundQueue final {
+	public:
+		/**
+		 * Create an inbound queue.
+		 * \param capacity		Max count of queued events (rounded up to a power of 2)
+		 * \param sysExCapacity	Max raw size of a queued MIDI system exclusive message
+		 */
+		explicit InboundQueue(int capacity = 1024, int sysExCapacity = Message::getLCDSize(112));
+
+		/**
+		 * Decode a message and push it. Called by the producer thread only.
+		 * \param message		Message
+		 * \param timeStamp		Time Stamp
+		 * \return	False if the message isn't a Mackie Control message or the queue is full
+		 */
+		bool push(const MessageView& message, double timeStamp);
+		/**
+		 * Decode a MIDI message and push it with its time stamp. Called by the producer thread only.
+		 * \return	False if the message isn't a Mackie Control message or the queue is full
+		 */
+		bool push(const juce::MidiMessage& message);
+		/**
+		 * Decode all events of a MIDI buffer and push them. Called by the producer thread only.
+		 * \param buffer		MIDI Buffer
+		 * \param timeStamp		Time Stamp of sample position 0
+		 * \param sampleRate	Sample Rate used to convert sample positions to time
+		 * \return	Count of pushed events
+		 */
+		int push(const juce::MidiBuffer& buffer, double timeStamp, double sampleRate);
+
+		/**
+		 * Pop events into the buffer. Called by the consumer thread only.
+		 * The bytes of MIDI system exclusive messages aren't copied, use the handler version to read them.
+		 * \return	Count of popped events
+		 */
+		int pop(std::span<InboundEvent> dest);
+		/**
+		 * Pop events and pass each one with its message view to the handler. Called by the consumer thread only.
+		 * The message view is valid until the handler returns.
+		 * \param handler		void(const InboundEvent&, const MessageView&)
+		 * \param maxEvents		Max count of popped events
+		 * \return	Count of popped events
+		 */
+		template <typename Handler>
+		int pop(Handler&& handler, int maxEvents = std::numeric_limits<int>::max()) {
+			uint32_t tail = this->tail.load(std::memory_order_relaxed);
+			uint32_t head = this->head.load(std::memory_order_acquire);
+			int count = static_cast<int>(std::min<uint32_t>(head - tail, static_cast<uint32_t>(std::max(maxEvents, 0))));
+
+			for (int i = 0; i < count; i++) {
+				uint32_t index = (tail + i) & this->mask;
+				auto& event = this->events[index];
+				if (event.type == MessageType::SysEx) {
+					handler(event, MessageView{ &(this->payloads[index * this->sysExCapacity]), event.size });
+				}
+				else {
+					handler(event, event.getView());
+				}
+			}
+
+			this->tail.store(tail + count, std::memory_order_release);
+			return count;
+		}
+
+		/**
+		 * Get the count of queued events.
+		 */
+		int getNumQueued() const;
+		/**
+		 * Get the capacity of the queue.
+		 */
+		int getCapacity() const;
+		/**
+		 * Get the count of events dropped because the queue was full.
+		 */
+		uint64_t getNumOverflows() const;
+		/**
+		 * Get the count of MIDI system exclusive messages dropped because they were larger than the capacity.
+		 */
+		uint64_t getNumOversized() const;
+		/**
+		 * Get the count of dropped messages which weren't Mackie Control messages.
+		 */
+		uint64_t getNumInvalid() const;
+
+	private:
+		std::vector<InboundEvent> events;
+		std::vector<uint8_t> payloads;
+		uint32_t mask = 0;
+		int sysExCapacity = 0;
+
+		alignas(64) std::atomic<uint32_t> head{ 0 };
+		alignas(64) std::atomic<uint32_t> tail{ 0 };
+
+		alignas(64) std::atomic<uint64_t> numOverflows{ 0 };
+		std::atomic<uint64_t> numOversized{ 0 };
+		std::atomic<uint64_t> numInvalid{ 0 };
+
+		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(InboundQueue)
+	};
+}
@@ -0,0 +1,110 @@
+/*****************************************************************//**
+ * \file	LCDFrameBuffer.cpp
+ * \brief	LCD frame buffer which sends the cheapest set of LCD messages.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ *********************************************************************/
+
+#include "LCDFrameBuffer.h"
+
+namespace mackieControl {
+	/** Sent character which is unknown on the surface. */
+	constexpr char unknownChar = static_cast<char>(0xFF);
+
+	LCDFrameBuffer::LCDFrameBuffer(const LCDCostModel& costModel)
+		: costModel(costModel) {
+		this->text.fill(' ');
+		this->invalidate();
+	}
+
+	void LCDFrameBuffer::setCostModel(const LCDCostModel& costModel) {
+		this->costModel = costModel;
+	}
+
+	const LCDCostModel& LCDFrameBuffer::getCostModel() const {
+		return this->costModel;
+	}
+
+	void LCDFrameBuffer::setText(uint8_t place, const char* data, int size) {
+		int end = std::min(static_cast<int>(place) + size, LCDFrameBuffer::size);
+		for (int i = place; i < end; i++) {
+			this->text[i] = data[i - place];
+		}
+	}
+
+	std::tuple<const char*, int> LCDFrameBuffer::getText() const {
+		return { this->text.data(), LCDFrameBuffer::size };
+	}
+
+	bool LCDFrameBuffer::isDirty() const {
+		return this->text != this->sentText;
+	}
+
+	void LCDFrameBuffer::invalidate() {
+		this->sentText.fill(unknownChar);
+	}
+
+	int LCDFrameBuffer::getRuns(std::span<LCDRun> dest) const {
+		int maxRunSize = std::max(this->costModel.maxRunSize, 1);
+		int count = 0;
+
+		for (int i = 0; i < LCDFrameBuffer::size && count < static_cast<int>(dest.size());) {
+			if (this->text[i] == this->sentText[i]) { i++; continue; }
+
+			int limit = std::min(i + maxRunSize, LCDFrameBuffer::size);
+			if (!this->costModel.crossLines && i < lineSize) {
+				limit = std::min(limit, lineSize);
+			}
+
+			// Merge the next change while resending the unchanged gap is not dearer than a new message
+			int end = i + 1;
+			for (int j = end; j < limit; j++) {
+				if (this->text[j] == this->sentText[j]) {
+					if ((j - end + 1) * this->costModel.characterCost > this->costModel.messageOverhead) { break; }
+					continue;
+				}
+				end = j + 1;
+			}
+
+			dest[count++] = { static_cast<uint8_t>(i), static_cast<uint8_t>(end - i) };
+			i = end;
+		}
+
+		return count;
+	}
+
+	void LCDFrameBuffer::markSent(const LCDRun& run) {
+		int end = std::min(run.place + run.size, LCDFrameBuffer::size);
+		for (int i = run.place; i < end; i++) {
+			this->sentText[i] = this->text[i];
+		}
+	}
+
+	int LCDFrameBuffer::flush(juce::MidiBuffer& buffer, int samplePosition) {
+		return this->flushTo([&buffer, samplePosition](const uint8_t* data, int size) {
+			return buffer.addEvent(data, size, samplePosition);
+			});
+	}
+
+	int LCDFrameBuffer::flush(std::span<uint8_t> dest) {
+		int used = 0;
+		this->flushTo([dest, &used](const uint8_t* data, int size) {
+			if (used + size > static_cast<int>(dest.size())) { return false; }
+			std::memcpy(&dest[used], data, size);
+			used += size;
+			return true;
+			});
+		return used;
+	}
+
+	uint64_t LCDFrameBuffer::getNumBytesSent() const {
+		return this->numBytesSent;
+	}
+
+	uint64_t LCDFrameBuffer::getNumBytesSaved() const {
+		return this->numBytesSaved;
+	}
+}
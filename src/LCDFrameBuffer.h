@@ -0,0 +1,168 @@
+﻿/*****************************************************************//**
+ * \file	LCDFrameBuffer.h
+ * \brief	LCD frame buffer which sends the cheapest set of LCD messages.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ *********************************************************************/
+
+#pragma once
+
+#include "MackieControl.h"
+
+namespace mackieControl {
+	/**
+	 * Cost model used to split LCD changes into LCD messages.
+	 */
+	struct MACKIE_API LCDCostModel final {
+		/** Bytes of each LCD message besides the characters. */
+		int messageOverhead = Message::getLCDSize(0);
+		/** Bytes of each character. */
+		int characterCost = 1;
+		/** Max characters in one LCD message. */
+		int maxRunSize = 112;
+		/** Allow one LCD message to continue from the upper line into the lower line. */
+		bool crossLines = true;
+	};
+
+	/**
+	 * A run of LCD characters sent by one LCD message.
+	 */
+	struct MACKIE_API LCDRun final {
+		/** Line Place */
+		uint8_t place = 0;
+		/** Character Count */
+		uint8_t size = 0;
+	};
+
+	/**
+	 * LCD frame buffer.
+	 * Compares the wanted text with the last-sent text, and sends the changes with the cheapest set of LCD messages.
+	 * Unchanged characters between two changes are resent when that is cheaper than starting a new message.
+	 */
+	class MACKIE_API LCDFrameBuffer final {
+	public:
+		/** Count of characters of each LCD line. */
+		static constexpr int lineSize = 56;
+		/** Count of characters of the LCD. */
+		static constexpr int size = lineSize * 2;
+
+		/**
+		 * Create an LCD frame buffer. The sent text is unknown, so the first flush sends the whole LCD.
+		 */
+		explicit LCDFrameBuffer(const LCDCostModel& costModel = LCDCostModel{});
+
+		/**
+		 * Set the cost model.
+		 */
+		void setCostModel(const LCDCostModel& costModel);
+		/**
+		 * Get the cost model.
+		 */
+		const LCDCostModel& getCostModel() const;
+
+		/**
+		 * Set the wanted characters.
+		 * \param place			Line Place
+		 * \param data			Data Pointer
+		 * \param size			Data Size
+		 */
+		void setText(uint8_t place, const char* data, int size);
+		/**
+		 * Get the wanted characters.
+		 * \return	Data Pointer, Data Size
+		 */
+		std::tuple<const char*, int> getText() const;
+
+		/**
+		 * Check if any character differs from the sent text.
+		 */
+		bool isDirty() const;
+		/**
+		 * Forget the sent text, so the next flush sends the whole LCD.
+		 */
+		void invalidate();
+
+		/**
+		 * Split the changed characters into the cheapest runs by the cost model.
+		 * \param dest			Destination Buffer
+		 * \return	Count of runs
+		 */
+		int getRuns(std::span<LCDRun> dest) const;
+		/**
+		 * Mark the characters of the run as sent.
+		 */
+		void markSent(const LCDRun& run);
+
+		/**
+		 * Append LCD messages of the changed characters to the MIDI buffer.
+		 * \param buffer		MIDI Buffer
+		 * \param samplePosition	Sample Position
+		 * \return	Count of bytes emitted
+		 */
+		int flush(juce::MidiBuffer& buffer, int samplePosition = 0);
+		/**
+		 * Write LCD messages of the changed characters into the buffer as raw MIDI bytes.
+		 * Runs which don't fit into the buffer stay dirty for the next flush.
+		 * \param dest			Destination Buffer
+		 * \return	Count of bytes written
+		 */
+		int flush(std::span<uint8_t> dest);
+		/**
+		 * Pass LCD messages of the changed characters to the writer as raw MIDI bytes.
+		 * Used by owners which emit the LCD messages with their other messages.
+		 * \param writer		bool(const uint8_t* data, int size), false stops the flush and keeps the rest dirty
+		 * \return	Count of bytes emitted
+		 */
+		template <typename Writer>
+		int flushTo(Writer&& writer) {
+			int lineCost = 0;
+			for (int line = 0; line < 2; line++) {
+				if (!std::equal(&(this->text[line * lineSize]), &(this->text[line * lineSize]) + lineSize,
+					&(this->sentText[line * lineSize]))) {
+					lineCost += Message::getLCDSize(lineSize);
+				}
+			}
+
+			std::array<LCDRun, LCDFrameBuffer::size> runs;
+			int numRuns = this->getRuns(runs);
+
+			int total = 0;
+			for (int i = 0; i < numRuns; i++) {
+				auto& run = runs[i];
+
+				std::array<uint8_t, Message::getLCDSize(LCDFrameBuffer::size)> bytes;
+				int size = Message::writeLCD(bytes, run.place, &(this->text[run.place]), run.size);
+				if (!writer(bytes.data(), size)) { break; }
+
+				this->markSent(run);
+				total += size;
+			}
+
+			this->numBytesSent += total;
+			if (!this->isDirty() && lineCost > total) {
+				this->numBytesSaved += lineCost - total;
+			}
+
+			return total;
+		}
+
+		/**
+		 * Get the count of bytes sent by this frame buffer.
+		 */
+		uint64_t getNumBytesSent() const;
+		/**
+		 * Get the count of bytes saved compared with resending each changed line.
+		 */
+		uint64_t getNumBytesSaved() const;
+
+	private:
+		LCDCostModel costModel;
+		std::array<char, size> text, sentText;
+		uint64_t numBytesSent = 0, numBytesSaved = 0;
+
+		JUCE_LEAK_DETECTOR(LCDFrameBuffer)
+	};
+}
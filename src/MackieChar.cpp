@@ -0,0 +1,134 @@
+/*****************************************************************//**
+ * \file	MackieChar.cpp
+ * \brief	Table-driven bulk conversion between ASCII and Mackie Control characters.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ *********************************************************************/
+
+#include "MackieChar.h"
+
+#if MACKIE_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace mackieControl {
+#if MACKIE_SSE2
+	/**
+	 * Get the mask of bytes in [low, high]. Bytes above 0x7F are negative and never in range.
+	 */
+	static __m128i inRange(__m128i x, char low, char high) {
+		return _mm_and_si128(_mm_cmpgt_epi8(x, _mm_set1_epi8(low - 1)), _mm_cmplt_epi8(x, _mm_set1_epi8(high + 1)));
+	}
+
+	/**
+	 * Select each byte from a or b by the mask.
+	 */
+	static __m128i select(__m128i mask, __m128i a, __m128i b) {
+		return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+	}
+
+	/**
+	 * Reverse the order of 16 bytes.
+	 */
+	static __m128i reverse(__m128i x) {
+		x = _mm_shuffle_epi32(x, _MM_SHUFFLE(0, 1, 2, 3));
+		x = _mm_shufflelo_epi16(x, _MM_SHUFFLE(2, 3, 0, 1));
+		x = _mm_shufflehi_epi16(x, _MM_SHUFFLE(2, 3, 0, 1));
+		return _mm_or_si128(_mm_slli_epi16(x, 8), _mm_srli_epi16(x, 8));
+	}
+
+	/**
+	 * Convert 16 ASCII characters, same as charToMackieTable.
+	 */
+	static __m128i toMackie16(__m128i x) {
+		__m128i result = _mm_set1_epi8(' ');
+		result = select(inRange(x, '0', '9'), x, result);
+		result = select(inRange(x, 'A', 'Z'), _mm_sub_epi8(x, _mm_set1_epi8('A' - 1)), result);
+		result = select(inRange(x, 'a', 'z'), _mm_sub_epi8(x, _mm_set1_epi8('a' - 1)), result);
+		return result;
+	}
+
+	/**
+	 * Convert 16 Mackie Control characters, same as mackieToCharTable.
+	 */
+	static __m128i toChar16(__m128i x) {
+		__m128i result = _mm_set1_epi8(' ');
+		result = select(inRange(x, '0', '9'), x, result);
+		result = select(inRange(x, 1, 'Z' - 'A' + 1), _mm_add_epi8(x, _mm_set1_epi8('A' - 1)), result);
+		return result;
+	}
+#endif
+
+	int toMackie(std::span<const char> src, std::span<uint8_t> dest) {
+		int size = static_cast<int>(std::min(src.size(), dest.size()));
+		int i = 0;
+
+#if MACKIE_SSE2
+		for (; i + 16 <= size; i += 16) {
+			__m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[i]));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(&dest[i]), toMackie16(x));
+		}
+#endif
+
+		for (; i < size; i++) {
+			dest[i] = charToMackieTable[static_cast<uint8_t>(src[i])];
+		}
+		return size;
+	}
+
+	int toChar(std::span<const uint8_t> src, std::span<char> dest) {
+		int size = static_cast<int>(std::min(src.size(), dest.size()));
+		int i = 0;
+
+#if MACKIE_SSE2
+		for (; i + 16 <= size; i += 16) {
+			__m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[i]));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(&dest[i]), toChar16(x));
+		}
+#endif
+
+		for (; i < size; i++) {
+			dest[i] = mackieToCharTable[src[i]];
+		}
+		return size;
+	}
+
+	int toMackieReversed(std::span<const char> src, std::span<uint8_t> dest) {
+		int size = static_cast<int>(std::min(src.size(), dest.size()));
+		const char* last = src.data() + src.size() - 1;
+		int i = 0;
+
+#if MACKIE_SSE2
+		for (; i + 16 <= size; i += 16) {
+			__m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(last - i - 15));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(&dest[i]), toMackie16(reverse(x)));
+		}
+#endif
+
+		for (; i < size; i++) {
+			dest[i] = charToMackieTable[static_cast<uint8_t>(*(last - i))];
+		}
+		return size;
+	}
+
+	int toCharReversed(std::span<const uint8_t> src, std::span<char> dest) {
+		int size = static_cast<int>(std::min(src.size(), dest.size()));
+		char* last = dest.data() + dest.size() - 1;
+		int i = 0;
+
+#if MACKIE_SSE2
+		for (; i + 16 <= size; i += 16) {
+			__m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[i]));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(last - i - 15), reverse(toChar16(x)));
+		}
+#endif
+
+		for (; i < size; i++) {
+			*(last - i) = mackieToCharTable[src[i]];
+		}
+		return size;
+	}
+}
@@ -0,0 +1,79 @@
+﻿/*****************************************************************//**
+ * \file	MackieChar.h
+ * \brief	Table-driven bulk conversion between ASCII and Mackie Control characters.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ *********************************************************************/
+
+#pragma once
+
+#include "MackieControl.h"
+
+namespace mackieControl {
+	/**
+	 * Create the lookup table from ASCII character to Mackie Control character.
+	 */
+	constexpr std::array<uint8_t, 256> makeCharToMackieTable() {
+		std::array<uint8_t, 256> result{};
+		for (int i = 0; i < 256; i++) {
+			if (i >= 'a' && i <= 'z') { result[i] = static_cast<uint8_t>((i - 'a') + 1); }
+			else if (i >= 'A' && i <= 'Z') { result[i] = static_cast<uint8_t>((i - 'A') + 1); }
+			else if (i >= '0' && i <= '9') { result[i] = static_cast<uint8_t>(i); }
+			else { result[i] = ' '; }
+		}
+		return result;
+	}
+	/**
+	 * Create the lookup table from Mackie Control character to ASCII character.
+	 */
+	constexpr std::array<char, 256> makeMackieToCharTable() {
+		std::array<char, 256> result{};
+		for (int i = 0; i < 256; i++) {
+			if (i >= 1 && i <= 'Z' - 'A' + 1) { result[i] = static_cast<char>('A' + (i - 1)); }
+			else if (i >= '0' && i <= '9') { result[i] = static_cast<char>(i); }
+			else { result[i] = ' '; }
+		}
+		return result;
+	}
+	/**
+	 * Lookup table from ASCII character to Mackie Control character.
+	 */
+	inline constexpr auto charToMackieTable = makeCharToMackieTable();
+	/**
+	 * Lookup table from Mackie Control character to ASCII character.
+	 */
+	inline constexpr auto mackieToCharTable = makeMackieToCharTable();
+
+	/**
+	 * Convert ASCII characters to Mackie Control characters.
+	 * \param src			ASCII Characters
+	 * \param dest			Mackie Control Characters
+	 * \return	Count of converted characters, the smaller size of src and dest
+	 */
+	int MACKIE_API toMackie(std::span<const char> src, std::span<uint8_t> dest);
+	/**
+	 * Convert Mackie Control characters to ASCII characters.
+	 * \param src			Mackie Control Characters
+	 * \param dest			ASCII Characters
+	 * \return	Count of converted characters, the smaller size of src and dest
+	 */
+	int MACKIE_API toChar(std::span<const uint8_t> src, std::span<char> dest);
+	/**
+	 * Convert ASCII characters to Mackie Control characters in reversed order.
+	 * The time code and assignment displays take the rightmost digit first, so "12345" becomes {'5', '4', '3', '2', '1'}.
+	 * \param src			ASCII Characters
+	 * \param dest			Mackie Control Characters
+	 * \return	Count of converted characters, the smaller size of src and dest
+	 */
+	int MACKIE_API toMackieReversed(std::span<const char> src, std::span<uint8_t> dest);
+	/**
+	 * Convert Mackie Control characters in reversed order to ASCII characters.
+	 * \param src			Mackie Control Characters
+	 * \param dest			ASCII Characters
+	 * \return	Count of converted characters, the smaller size of src and dest
+	 */
+	int MACKIE_API toCharReversed(std::span<const uint8_t> src, std::span<char> dest);
+}
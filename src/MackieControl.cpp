@@ -10,128 +10,62 @@
  *********************************************************************/
 
 #include "MackieControl.h"
+#include "MessageView.h"
+#include "MackieChar.h"
 
 namespace mackieControl {
-	constinit auto validSysExMessage = std::to_array({
-		SysExMessage::DeviceQuery,
-		SysExMessage::HostConnectionQuery,
-		SysExMessage::HostConnectionReply,
-		SysExMessage::HostConnectionConfirmation,
-		SysExMessage::HostConnectionError,
-		SysExMessage::LCDBackLightSaver,
-		SysExMessage::TouchlessMovableFaders,
-		SysExMessage::FaderTouchSensitivity,
-		SysExMessage::GoOffline,
-		SysExMessage::TimeCodeBBTDisplay,
-		SysExMessage::Assignment7SegmentDisplay,
-		SysExMessage::LCD,
-		SysExMessage::VersionRequest,
-		SysExMessage::VersionReply,
-		SysExMessage::ChannelMeterMode,
-		SysExMessage::GlobalLCDMeterMode,
-		SysExMessage::AllFaderstoMinimum,
-		SysExMessage::AllLEDsOff,
-		SysExMessage::Reset
-		});
-	constexpr bool isValidSysExMessage(SysExMessage mes) {
-		return std::find(validSysExMessage.begin(), validSysExMessage.end(), mes) != validSysExMessage.end();
-	}
-	constexpr bool isValidSysExMessage(int mes) {
-		return isValidSysExMessage(static_cast<SysExMessage>(mes));
-	}
-
-	constinit auto validVelocityMessage = std::to_array({
-		VelocityMessage::Off,
-		VelocityMessage::Flashing,
-		VelocityMessage::On
-		});
-	constexpr bool isValidVelocityMessage(VelocityMessage mes) {
-		return std::find(validVelocityMessage.begin(), validVelocityMessage.end(), mes) != validVelocityMessage.end();
-	}
-	constexpr bool isValidVelocityMessage(int mes) {
-		return isValidVelocityMessage(static_cast<VelocityMessage>(mes));
-	}
-
-	constinit auto validNoteMessage = std::to_array({
-		NoteMessage::RECRDYCh1, NoteMessage::RECRDYCh2, NoteMessage::RECRDYCh3, NoteMessage::RECRDYCh4,
-		NoteMessage::RECRDYCh5, NoteMessage::RECRDYCh6, NoteMessage::RECRDYCh7, NoteMessage::RECRDYCh8,
-		NoteMessage::SOLOCh1, NoteMessage::SOLOCh2, NoteMessage::SOLOCh3, NoteMessage::SOLOCh4,
-		NoteMessage::SOLOCh5, NoteMessage::SOLOCh6, NoteMessage::SOLOCh7, NoteMessage::SOLOCh8,
-		NoteMessage::MUTECh1, NoteMessage::MUTECh2, NoteMessage::MUTECh3, NoteMessage::MUTECh4,
-		NoteMessage::MUTECh5, NoteMessage::MUTECh6, NoteMessage::MUTECh7, NoteMessage::MUTECh8,
-		NoteMessage::SELECTCh1, NoteMessage::SELECTCh2, NoteMessage::SELECTCh3, NoteMessage::SELECTCh4,
-		NoteMessage::SELECTCh5, NoteMessage::SELECTCh6, NoteMessage::SELECTCh7, NoteMessage::SELECTCh8,
-		NoteMessage::VSelectCh1, NoteMessage::VSelectCh2, NoteMessage::VSelectCh3, NoteMessage::VSelectCh4,
-		NoteMessage::VSelectCh5, NoteMessage::VSelectCh6, NoteMessage::VSelectCh7, NoteMessage::VSelectCh8,
-		NoteMessage::ASSIGNMENTTRACK, NoteMessage::ASSIGNMENTSEND, NoteMessage::ASSIGNMENTPANSURROUND,
-		NoteMessage::ASSIGNMENTPLUGIN, NoteMessage::ASSIGNMENTEQ, NoteMessage::ASSIGNMENTINSTRUMENT,
-		NoteMessage::FADERBANKSBANKLeft, NoteMessage::FADERBANKSBANKRight,
-		NoteMessage::FADERBANKSCHANNELLeft, NoteMessage::FADERBANKSCHANNELRight,
-		NoteMessage::FLIP,
-		NoteMessage::GLOBALVIEW,
-		NoteMessage::NAMEVALUE,
-		NoteMessage::SMPTEBEATS,
-		NoteMessage::Function1, NoteMessage::Function2, NoteMessage::Function3, NoteMessage::Function4,
-		NoteMessage::Function5, NoteMessage::Function6, NoteMessage::Function7, NoteMessage::Function8,
-		NoteMessage::GLOBALVIEWMIDITRACKS, NoteMessage::GLOBALVIEWINPUTS,
-		NoteMessage::GLOBALVIEWAUDIOTRACKS, NoteMessage::GLOBALVIEWAUDIOINSTRUMENT,
-		NoteMessage::GLOBALVIEWAUX, NoteMessage::GLOBALVIEWBUSSES,
-		NoteMessage::GLOBALVIEWOUTPUTS, NoteMessage::GLOBALVIEWUSER,
-		NoteMessage::SHIFT, NoteMessage::OPTION, NoteMessage::CONTROL, NoteMessage::CMDALT,
-		NoteMessage::AUTOMATIONREADOFF, NoteMessage::AUTOMATIONWRITE, NoteMessage::AUTOMATIONTRIM,
-		NoteMessage::AUTOMATIONTOUCH, NoteMessage::AUTOMATIONLATCH,
-		NoteMessage::GROUP,
-		NoteMessage::UTILITIESSAVE, NoteMessage::UTILITIESUNDO,
-		NoteMessage::UTILITIESCANCEL, NoteMessage::UTILITIESENTER,
-		NoteMessage::MARKER,
-		NoteMessage::NUDGE,
-		NoteMessage::CYCLE,
-		NoteMessage::DROP,
-		NoteMessage::REPLACE,
-		NoteMessage::CLICK,
-		NoteMessage::SOLO,
-		NoteMessage::REWIND, NoteMessage::FASTFWD, NoteMessage::STOP, NoteMessage::PLAY, NoteMessage::RECORD,
-		NoteMessage::CursorUp, NoteMessage::CursorDown, NoteMessage::CursorLeft, NoteMessage::CursorRight,
-		NoteMessage::Zoom,
-		NoteMessage::Scrub,
-		NoteMessage::UserSwitchA, NoteMessage::UserSwitchB,
-		NoteMessage::FaderTouchCh1, NoteMessage::FaderTouchCh2,
-		NoteMessage::FaderTouchCh3, NoteMessage::FaderTouchCh4,
-		NoteMessage::FaderTouchCh5, NoteMessage::FaderTouchCh6,
-		NoteMessage::FaderTouchCh7, NoteMessage::FaderTouchCh8,
-		NoteMessage::FaderTouchMaster,
-		NoteMessage::SMPTELED,
-		NoteMessage::BEATSLED,
-		NoteMessage::RUDESOLOLIGHT,
-		NoteMessage::Relayclick
-		});
-	constexpr bool isValidNoteMessage(NoteMessage mes) {
-		return std::find(validNoteMessage.begin(), validNoteMessage.end(), mes) != validNoteMessage.end();
-	}
-	constexpr bool isValidNoteMessage(int mes) {
-		return isValidNoteMessage(static_cast<NoteMessage>(mes));
-	}
-
-	constinit auto validCCMessage = std::to_array({
-		CCMessage::VPot1, CCMessage::VPot2, CCMessage::VPot3, CCMessage::VPot4,
-		CCMessage::VPot5, CCMessage::VPot6, CCMessage::VPot7, CCMessage::VPot8,
-		CCMessage::ExternalController,
-		CCMessage::VPotLEDRing1, CCMessage::VPotLEDRing2, CCMessage::VPotLEDRing3, CCMessage::VPotLEDRing4,
-		CCMessage::VPotLEDRing5, CCMessage::VPotLEDRing6, CCMessage::VPotLEDRing7, CCMessage::VPotLEDRing8,
-		CCMessage::JogWheel,
-		CCMessage::TimeCodeBBTDisplay1, CCMessage::TimeCodeBBTDisplay2,
-		CCMessage::TimeCodeBBTDisplay3, CCMessage::TimeCodeBBTDisplay4,
-		CCMessage::TimeCodeBBTDisplay5, CCMessage::TimeCodeBBTDisplay6,
-		CCMessage::TimeCodeBBTDisplay7, CCMessage::TimeCodeBBTDisplay8,
-		CCMessage::TimeCodeBBTDisplay9, CCMessage::TimeCodeBBTDisplay10,
-		CCMessage::Assignment7SegmentDisplay1, CCMessage::Assignment7SegmentDisplay2,
-		CCMessage::Assignment7SegmentDisplay3
-		});
-	constexpr bool isValidCCMessage(CCMessage mes) {
-		return std::find(validCCMessage.begin(), validCCMessage.end(), mes) != validCCMessage.end();
-	}
-	constexpr bool isValidCCMessage(int mes) {
-		return isValidCCMessage(static_cast<CCMessage>(mes));
+	/** Size of the stack buffer used to build variable-length system exclusive messages. */
+	constexpr int sysExStackSize = 256;
+
+	/**
+	 * Write 0xF0, the header bytes and the message type of a system exclusive message.
+	 */
+	static void writeSysExHeader(std::span<uint8_t> dest, SysExMessage type) {
+		dest[0] = 0xF0;
+		std::memset(&dest[1], 0, 4);
+		dest[1 + 4] = static_cast<uint8_t>(type);
+	}
+
+	/**
+	 * Encode a variable-length system exclusive message with its write function, on the stack if it fits,
+	 * and pass the encoded bytes to the consumer.
+	 * \param consumer		Result(const uint8_t* data, int size), size is 0 if the message can't be encoded
+	 * \param write			Write function of the message
+	 * \param byteSize		Raw size of the message from its get*Size function
+	 */
+	template <typename Consumer, typename... Args>
+	static auto encodeSysEx(Consumer&& consumer,
+		int (*write)(std::span<uint8_t>, Args...), int byteSize, std::type_identity_t<Args>... args) {
+		std::array<uint8_t, sysExStackSize> stackBytes;
+		std::vector<uint8_t> heapBytes;
+		std::span<uint8_t> bytes{ stackBytes };
+		if (byteSize > sysExStackSize) {
+			heapBytes.resize(byteSize);
+			bytes = heapBytes;
+		}
+
+		return consumer(bytes.data(), write(bytes, args...));
+	}
+
+	/**
+	 * Encode a variable-length system exclusive message and copy it once into the message.
+	 */
+	template <typename... Args>
+	static Message createSysEx(int (*write)(std::span<uint8_t>, Args...), int byteSize, std::type_identity_t<Args>... args) {
+		return encodeSysEx([](const uint8_t* data, int size) {
+			return (size > 0) ? Message{ juce::MidiMessage{ data, size } } : Message{};
+			}, write, byteSize, args...);
+	}
+
+	/**
+	 * Encode a variable-length system exclusive message and append it to the MIDI buffer.
+	 */
+	template <typename... Args>
+	static bool addSysEx(juce::MidiBuffer& buffer, int samplePosition,
+		int (*write)(std::span<uint8_t>, Args...), int byteSize, std::type_identity_t<Args>... args) {
+		return encodeSysEx([&buffer, samplePosition](const uint8_t* data, int size) {
+			return (size > 0) && buffer.addEvent(data, size, samplePosition);
+			}, write, byteSize, args...);
 	}
 
 	Message::Message(const juce::MidiMessage& midiMessage)
@@ -166,203 +100,112 @@ namespace mackieControl {
 		return this->message;
 	}
 
+	const uint8_t* Message::getRawData() const {
+		return this->message.getRawData();
+	}
+
+	int Message::getRawDataSize() const {
+		return this->message.getRawDataSize();
+	}
+
 	bool Message::isSysEx() const {
-		if (this->message.isSysEx()) {
-			if (this->message.getSysExDataSize() >= 5) {
-				auto ptrData = this->message.getSysExData();
-				return isValidSysExMessage(ptrData[4]);
-			}
-		}
-		return false;
+		return this->getType() == MessageType::SysEx;
 	}
 
 	bool Message::isNote() const {
-		if (this->message.isNoteOnOrOff()) {
-			return isValidNoteMessage(this->message.getNoteNumber()) &&
-				isValidVelocityMessage(this->message.getVelocity());
-		}
-		return false;
+		return this->getType() == MessageType::Note;
 	}
 
 	bool Message::isCC() const {
-		if (this->message.isController()) {
-			return isValidCCMessage(this->message.getControllerNumber());
-		}
-		return false;
+		return this->getType() == MessageType::CC;
 	}
 
 	bool Message::isPitchWheel() const {
-		if (this->message.isPitchWheel()) {
-			auto channel = this->message.getChannel();
-			return channel >= 1 && channel <= 9;
-		}
-		return false;
+		return this->getType() == MessageType::PitchWheel;
 	}
 
 	bool Message::isChannelPressure() const {
-		if (this->message.isChannelPressure()) {
-			return true;
-		}
-		return false;
+		return this->getType() == MessageType::ChannelPressure;
 	}
 
 	bool Message::isMackieControl() const {
-		return this->isSysEx() ||
-			this->isNote() ||
-			this->isCC() ||
-			this->isPitchWheel() ||
-			this->isChannelPressure();
+		return this->getType() != MessageType::Invalid;
+	}
+
+	MessageType Message::getType() const {
+		return classifyMessage(this->message.getRawData(), this->message.getRawDataSize());
 	}
 
 	std::tuple<SysExMessage> Message::getSysExData() const {
-		if (this->message.getSysExDataSize() < 5) { return { static_cast<SysExMessage>(-1) }; }
-		return { static_cast<SysExMessage>(this->message.getSysExData()[4]) };
+		return MessageView{ *this }.getSysExData();
 	}
 
 	std::tuple<std::array<uint8_t, 7>, uint32_t> Message::getHostConnectionQueryData() const {
-		if (this->message.getSysExDataSize() <
-			5 + sizeof(std::array<uint8_t, 7>) + sizeof(uint32_t)) { return std::tuple<std::array<uint8_t, 7>, uint32_t>{}; }
-
-		std::array<uint8_t, 7> bytes;
-		std::memcpy(bytes.data(), &(this->message.getSysExData()[5]), sizeof(bytes));
-
-		return { bytes, static_cast<uint32_t>(this->message.getSysExData()[5 + sizeof(bytes)]) };
+		return MessageView{ *this }.getHostConnectionQueryData();
 	}
 
 	std::tuple<std::array<uint8_t, 7>, uint32_t> Message::getHostConnectionReplyData() const {
-		if (this->message.getSysExDataSize() <
-			5 + sizeof(std::array<uint8_t, 7>) + sizeof(uint32_t)) {
-			return std::tuple<std::array<uint8_t, 7>, uint32_t>{};
-		}
-
-		std::array<uint8_t, 7> bytes;
-		std::memcpy(bytes.data(), &(this->message.getSysExData()[5]), sizeof(bytes));
-
-		return { bytes, static_cast<uint32_t>(this->message.getSysExData()[5 + sizeof(bytes)]) };
+		return MessageView{ *this }.getHostConnectionReplyData();
 	}
 
 	std::tuple<std::array<uint8_t, 7>> Message::getHostConnectionConfirmationData() const {
-		if (this->message.getSysExDataSize() < 5 + sizeof(std::array<uint8_t, 7>)) {
-			return std::tuple<std::array<uint8_t, 7>>{};
-		}
-
-		std::array<uint8_t, 7> bytes;
-		std::memcpy(bytes.data(), &(this->message.getSysExData()[5]), sizeof(bytes));
-
-		return { bytes };
+		return MessageView{ *this }.getHostConnectionConfirmationData();
 	}
 
 	std::tuple<std::array<uint8_t, 7>> Message::getHostConnectionErrorData() const {
-		if (this->message.getSysExDataSize() < 5 + sizeof(std::array<uint8_t, 7>)) {
-			return std::tuple<std::array<uint8_t, 7>>{};
-		}
-
-		std::array<uint8_t, 7> bytes;
-		std::memcpy(bytes.data(), &(this->message.getSysExData()[5]), sizeof(bytes));
-
-		return { bytes };
+		return MessageView{ *this }.getHostConnectionErrorData();
 	}
 
 	std::tuple<uint8_t, uint8_t> Message::getLCDBackLightSaverData() const {
-		if (this->message.getSysExDataSize() < 5 + 1) {
-			return std::tuple<uint8_t, uint8_t>{};
-		}
-
-		return { static_cast<uint8_t>(this->message.getSysExData()[5]),
-			(this->message.getSysExDataSize() >= 7) ? static_cast<uint8_t>(this->message.getSysExData()[6]) : 0 };
+		return MessageView{ *this }.getLCDBackLightSaverData();
 	}
 
 	std::tuple<uint8_t> Message::getTouchlessMovableFadersData() const {
-		if (this->message.getSysExDataSize() < 5 + 1) {
-			return std::tuple<uint8_t>{};
-		}
-
-		return { static_cast<uint8_t>(this->message.getSysExData()[5]) };
+		return MessageView{ *this }.getTouchlessMovableFadersData();
 	}
 
 	std::tuple<uint8_t, uint8_t> Message::getFaderTouchSensitivityData() const {
-		if (this->message.getSysExDataSize() < 5 + 2) {
-			return std::tuple<uint8_t, uint8_t>{};
-		}
-
-		return { static_cast<uint8_t>(this->message.getSysExData()[5]),
-			static_cast<uint8_t>(this->message.getSysExData()[6]) };
+		return MessageView{ *this }.getFaderTouchSensitivityData();
 	}
 
 	std::tuple<const uint8_t*, int> Message::getTimeCodeBBTDisplayData() const {
-		if (this->message.getSysExDataSize() < 5 + 1 + 1 + 1) {
-			return std::tuple<uint8_t*, int>{};
-		}
-
-		return { &(this->message.getSysExData()[6]),
-			this->message.getSysExDataSize() - 1 - 6 };
+		return MessageView{ *this }.getTimeCodeBBTDisplayData();
 	}
 
 	std::tuple<std::array<uint8_t, 2>> Message::getAssignment7SegmentDisplayData() const {
-		if (this->message.getSysExDataSize() < 5 + 1 + sizeof(std::array<uint8_t, 2>)) {
-			return std::tuple<std::array<uint8_t, 2>>{};
-		}
-
-		std::array<uint8_t, 2> bytes;
-		std::memcpy(bytes.data(), &(this->message.getSysExData()[6]), sizeof(bytes));
-
-		return { bytes };
+		return MessageView{ *this }.getAssignment7SegmentDisplayData();
 	}
 
 	std::tuple<uint8_t, const char*, int> Message::getLCDData() const {
-		if (this->message.getSysExDataSize() < 5 + 1 + 1) {
-			return std::tuple<uint8_t, char*, int>{};
-		}
-
-		return { static_cast<uint8_t>(this->message.getSysExData()[5]),
-			reinterpret_cast<const char*>(&(this->message.getSysExData()[6])) ,
-			this->message.getSysExDataSize() - 6 };
+		return MessageView{ *this }.getLCDData();
 	}
 
 	std::tuple<const char*, int> Message::getVersionReplyData() const {
-		if (this->message.getSysExDataSize() < 5 + 1 + 1) {
-			return std::tuple<char*, int>{};
-		}
-
-		return { reinterpret_cast<const char*>(&(this->message.getSysExData()[6])) ,
-			this->message.getSysExDataSize() - 6 };
+		return MessageView{ *this }.getVersionReplyData();
 	}
 
 	std::tuple<uint8_t, uint8_t> Message::getChannelMeterModeData() const {
-		if (this->message.getSysExDataSize() < 5 + 2) {
-			return std::tuple<uint8_t, uint8_t>{};
-		}
-
-		return { static_cast<uint8_t>(this->message.getSysExData()[5]),
-			static_cast<uint8_t>(this->message.getSysExData()[6]) };
+		return MessageView{ *this }.getChannelMeterModeData();
 	}
 
 	std::tuple<uint8_t> Message::getGlobalLCDMeterModeData() const {
-		if (this->message.getSysExDataSize() < 5 + 1) {
-			return std::tuple<uint8_t>{};
-		}
-
-		return { static_cast<uint8_t>(this->message.getSysExData()[5]) };
+		return MessageView{ *this }.getGlobalLCDMeterModeData();
 	}
 
 	std::tuple<NoteMessage, VelocityMessage> Message::getNoteData() const {
-		return { static_cast<NoteMessage>(this->message.getNoteNumber()),
-			static_cast<VelocityMessage>(this->message.getVelocity()) };
+		return MessageView{ *this }.getNoteData();
 	}
 
 	std::tuple<CCMessage, int> Message::getCCData() const {
-		return { static_cast<CCMessage>(this->message.getControllerNumber()),
-			this->message.getControllerValue() };
+		return MessageView{ *this }.getCCData();
 	}
 
 	std::tuple<int, int> Message::getPitchWheelData() const {
-		return { this->message.getChannel(),
-			this->message.getPitchWheelValue() };
+		return MessageView{ *this }.getPitchWheelData();
 	}
 
 	std::tuple<int, int> Message::getChannelPressureData() const {
-		int value = this->message.getChannelPressureValue();
-		return { value / 16 + 1,value % 16 };
+		return MessageView{ *this }.getChannelPressureData();
 	}
 
 	Message Message::fromMidi(const juce::MidiMessage& message) {
@@ -456,13 +299,7 @@ namespace mackieControl {
 	}
 
 	Message Message::createTimeCodeBBTDisplay(const uint8_t* data, int size) {
-		int byteSize = 5 + 1 + size + 1;
-		auto bytes = std::unique_ptr<uint8_t[]>(new uint8_t[byteSize]());
-
-		bytes[4] = static_cast<uint8_t>(SysExMessage::TimeCodeBBTDisplay);
-		std::memcpy(&bytes[6], data, size);
-
-		return Message{ juce::MidiMessage::createSysExMessage(bytes.get(), byteSize) };
+		return createSysEx(&Message::writeTimeCodeBBTDisplay, getTimeCodeBBTDisplaySize(size), data, size);
 	}
 
 	Message Message::createAssignment7SegmentDisplay(const std::array<uint8_t, 2>& data) {
@@ -474,14 +311,7 @@ namespace mackieControl {
 	}
 
 	Message Message::createLCD(uint8_t place, const char* data, int size) {
-		int byteSize = 5 + 1 + size;
-		auto bytes = std::unique_ptr<uint8_t[]>(new uint8_t[byteSize]());
-
-		bytes[4] = static_cast<uint8_t>(SysExMessage::LCD);
-		bytes[5] = place;
-		std::memcpy(&bytes[6], data, size);
-
-		return Message{ juce::MidiMessage::createSysExMessage(bytes.get(), byteSize) };
+		return createSysEx(&Message::writeLCD, getLCDSize(size), place, data, size);
 	}
 
 	Message Message::createVersionRequest() {
@@ -492,13 +322,7 @@ namespace mackieControl {
 	}
 
 	Message Message::createVersionReply(const char* data, int size) {
-		int byteSize = 5 + 1 + size;
-		auto bytes = std::unique_ptr<uint8_t[]>(new uint8_t[byteSize]());
-
-		bytes[4] = static_cast<uint8_t>(SysExMessage::VersionReply);
-		std::memcpy(&bytes[6], data, size);
-
-		return Message{ juce::MidiMessage::createSysExMessage(bytes.get(), byteSize) };
+		return createSysEx(&Message::writeVersionReply, getVersionReplySize(size), data, size);
 	}
 
 	Message Message::createChannelMeterMode(uint8_t channelNumber, uint8_t mode) {
@@ -555,19 +379,61 @@ namespace mackieControl {
 		return Message{ juce::MidiMessage::channelPressureChange(1, (channel - 1) * 16 + value) };
 	}
 
-	uint8_t Message::charToMackie(char c) {
-		if (c >= 'a' && c <= 'z') { return (c - 'a') + 1; }
-		else if (c >= 'A' && c <= 'Z') { return (c - 'A') + 1; }
-		else if (c >= '0' && c <= '9') { return c; }
+	int Message::writeTimeCodeBBTDisplay(std::span<uint8_t> dest, const uint8_t* data, int size) {
+		int byteSize = getTimeCodeBBTDisplaySize(size);
+		if (size < 0 || static_cast<int>(dest.size()) < byteSize) { return 0; }
+
+		writeSysExHeader(dest, SysExMessage::TimeCodeBBTDisplay);
+		dest[1 + 5] = 0;
+		std::memcpy(&dest[1 + 6], data, size);
+		dest[1 + 6 + size] = 0;
+		dest[byteSize - 1] = 0xF7;
 
-		return ' ';
+		return byteSize;
 	}
 
-	char Message::mackieToChar(uint8_t c) {
-		if ((c - 1) >= 0 && (c - 1) <= 'Z' - 'A') { return 'A' + (c - 1); }
-		else if (c >= '0' && c <= '9') { return c; }
+	int Message::writeLCD(std::span<uint8_t> dest, uint8_t place, const char* data, int size) {
+		int byteSize = getLCDSize(size);
+		if (size < 0 || static_cast<int>(dest.size()) < byteSize) { return 0; }
+
+		writeSysExHeader(dest, SysExMessage::LCD);
+		dest[1 + 5] = place;
+		std::memcpy(&dest[1 + 6], data, size);
+		dest[byteSize - 1] = 0xF7;
+
+		return byteSize;
+	}
+
+	int Message::writeVersionReply(std::span<uint8_t> dest, const char* data, int size) {
+		int byteSize = getVersionReplySize(size);
+		if (size < 0 || static_cast<int>(dest.size()) < byteSize) { return 0; }
+
+		writeSysExHeader(dest, SysExMessage::VersionReply);
+		dest[1 + 5] = 0;
+		std::memcpy(&dest[1 + 6], data, size);
+		dest[byteSize - 1] = 0xF7;
+
+		return byteSize;
+	}
+
+	bool Message::addTimeCodeBBTDisplay(juce::MidiBuffer& buffer, int samplePosition, const uint8_t* data, int size) {
+		return addSysEx(buffer, samplePosition, &Message::writeTimeCodeBBTDisplay, getTimeCodeBBTDisplaySize(size), data, size);
+	}
+
+	bool Message::addLCD(juce::MidiBuffer& buffer, int samplePosition, uint8_t place, const char* data, int size) {
+		return addSysEx(buffer, samplePosition, &Message::writeLCD, getLCDSize(size), place, data, size);
+	}
+
+	bool Message::addVersionReply(juce::MidiBuffer& buffer, int samplePosition, const char* data, int size) {
+		return addSysEx(buffer, samplePosition, &Message::writeVersionReply, getVersionReplySize(size), data, size);
+	}
 
-		return ' ';
+	uint8_t Message::charToMackie(char c) {
+		return charToMackieTable[static_cast<uint8_t>(c)];
+	}
+
+	char Message::mackieToChar(uint8_t c) {
+		return mackieToCharTable[c];
 	}
 
 	uint8_t Message::toLCDPlace(bool lowerLine, uint8_t index) {
@@ -12,10 +12,23 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include <span>
 
 #include "Macros.h"
 
 namespace mackieControl {
+	/**
+	 * Create a 256-entry lookup table which marks every value of the list as valid.
+	 */
+	template <typename T, std::size_t N>
+	constexpr std::array<bool, 256> makeValidTable(const std::array<T, N>& values) {
+		std::array<bool, 256> result{};
+		for (auto value : values) {
+			result[static_cast<uint8_t>(value)] = true;
+		}
+		return result;
+	}
+
 	/**
 	 * Mackie Control messages via MIDI system exclusive message.
 	 */
@@ -40,14 +53,46 @@ namespace mackieControl {
 		AllLEDsOff,
 		Reset
 	};
+	/**
+	 * All valid SysExMessage values.
+	 */
+	inline constexpr auto validSysExMessage = std::to_array({
+		SysExMessage::DeviceQuery,
+		SysExMessage::HostConnectionQuery,
+		SysExMessage::HostConnectionReply,
+		SysExMessage::HostConnectionConfirmation,
+		SysExMessage::HostConnectionError,
+		SysExMessage::LCDBackLightSaver,
+		SysExMessage::TouchlessMovableFaders,
+		SysExMessage::FaderTouchSensitivity,
+		SysExMessage::GoOffline,
+		SysExMessage::TimeCodeBBTDisplay,
+		SysExMessage::Assignment7SegmentDisplay,
+		SysExMessage::LCD,
+		SysExMessage::VersionRequest,
+		SysExMessage::VersionReply,
+		SysExMessage::ChannelMeterMode,
+		SysExMessage::GlobalLCDMeterMode,
+		SysExMessage::AllFaderstoMinimum,
+		SysExMessage::AllLEDsOff,
+		SysExMessage::Reset
+		});
+	/**
+	 * Lookup table of valid SysExMessage values.
+	 */
+	inline constexpr auto validSysExMessageTable = makeValidTable(validSysExMessage);
 	/**
 	 * Check if the message is valid.
 	 */
-	constexpr bool MACKIE_API isValidSysExMessage(SysExMessage mes);
+	constexpr bool MACKIE_API isValidSysExMessage(SysExMessage mes) {
+		return validSysExMessageTable[static_cast<uint8_t>(mes)];
+	}
 	/**
 	 * Check if the message is valid.
 	 */
-	constexpr bool MACKIE_API isValidSysExMessage(int mes);
+	constexpr bool MACKIE_API isValidSysExMessage(int mes) {
+		return isValidSysExMessage(static_cast<SysExMessage>(mes));
+	}
 
 	/**
 	 * Mackie Control messages via MIDI note message velocity data.
@@ -57,14 +102,30 @@ namespace mackieControl {
 		Flashing,
 		On = 127
 	};
+	/**
+	 * All valid VelocityMessage values.
+	 */
+	inline constexpr auto validVelocityMessage = std::to_array({
+		VelocityMessage::Off,
+		VelocityMessage::Flashing,
+		VelocityMessage::On
+		});
+	/**
+	 * Lookup table of valid VelocityMessage values.
+	 */
+	inline constexpr auto validVelocityMessageTable = makeValidTable(validVelocityMessage);
 	/**
 	 * Check if the message is valid.
 	 */
-	constexpr bool MACKIE_API isValidVelocityMessage(VelocityMessage mes);
+	constexpr bool MACKIE_API isValidVelocityMessage(VelocityMessage mes) {
+		return validVelocityMessageTable[static_cast<uint8_t>(mes)];
+	}
 	/**
 	 * Check if the message is valid.
 	 */
-	constexpr bool MACKIE_API isValidVelocityMessage(int mes);
+	constexpr bool MACKIE_API isValidVelocityMessage(int mes) {
+		return isValidVelocityMessage(static_cast<VelocityMessage>(mes));
+	}
 
 	/**
 	 * Mackie Control messages via MIDI note message note number data.
@@ -108,14 +169,79 @@ namespace mackieControl {
 		RUDESOLOLIGHT,
 		Relayclick
 	};
+	/**
+	 * All valid NoteMessage values.
+	 */
+	inline constexpr auto validNoteMessage = std::to_array({
+		NoteMessage::RECRDYCh1, NoteMessage::RECRDYCh2, NoteMessage::RECRDYCh3, NoteMessage::RECRDYCh4,
+		NoteMessage::RECRDYCh5, NoteMessage::RECRDYCh6, NoteMessage::RECRDYCh7, NoteMessage::RECRDYCh8,
+		NoteMessage::SOLOCh1, NoteMessage::SOLOCh2, NoteMessage::SOLOCh3, NoteMessage::SOLOCh4,
+		NoteMessage::SOLOCh5, NoteMessage::SOLOCh6, NoteMessage::SOLOCh7, NoteMessage::SOLOCh8,
+		NoteMessage::MUTECh1, NoteMessage::MUTECh2, NoteMessage::MUTECh3, NoteMessage::MUTECh4,
+		NoteMessage::MUTECh5, NoteMessage::MUTECh6, NoteMessage::MUTECh7, NoteMessage::MUTECh8,
+		NoteMessage::SELECTCh1, NoteMessage::SELECTCh2, NoteMessage::SELECTCh3, NoteMessage::SELECTCh4,
+		NoteMessage::SELECTCh5, NoteMessage::SELECTCh6, NoteMessage::SELECTCh7, NoteMessage::SELECTCh8,
+		NoteMessage::VSelectCh1, NoteMessage::VSelectCh2, NoteMessage::VSelectCh3, NoteMessage::VSelectCh4,
+		NoteMessage::VSelectCh5, NoteMessage::VSelectCh6, NoteMessage::VSelectCh7, NoteMessage::VSelectCh8,
+		NoteMessage::ASSIGNMENTTRACK, NoteMessage::ASSIGNMENTSEND, NoteMessage::ASSIGNMENTPANSURROUND,
+		NoteMessage::ASSIGNMENTPLUGIN, NoteMessage::ASSIGNMENTEQ, NoteMessage::ASSIGNMENTINSTRUMENT,
+		NoteMessage::FADERBANKSBANKLeft, NoteMessage::FADERBANKSBANKRight,
+		NoteMessage::FADERBANKSCHANNELLeft, NoteMessage::FADERBANKSCHANNELRight,
+		NoteMessage::FLIP,
+		NoteMessage::GLOBALVIEW,
+		NoteMessage::NAMEVALUE,
+		NoteMessage::SMPTEBEATS,
+		NoteMessage::Function1, NoteMessage::Function2, NoteMessage::Function3, NoteMessage::Function4,
+		NoteMessage::Function5, NoteMessage::Function6, NoteMessage::Function7, NoteMessage::Function8,
+		NoteMessage::GLOBALVIEWMIDITRACKS, NoteMessage::GLOBALVIEWINPUTS,
+		NoteMessage::GLOBALVIEWAUDIOTRACKS, NoteMessage::GLOBALVIEWAUDIOINSTRUMENT,
+		NoteMessage::GLOBALVIEWAUX, NoteMessage::GLOBALVIEWBUSSES,
+		NoteMessage::GLOBALVIEWOUTPUTS, NoteMessage::GLOBALVIEWUSER,
+		NoteMessage::SHIFT, NoteMessage::OPTION, NoteMessage::CONTROL, NoteMessage::CMDALT,
+		NoteMessage::AUTOMATIONREADOFF, NoteMessage::AUTOMATIONWRITE, NoteMessage::AUTOMATIONTRIM,
+		NoteMessage::AUTOMATIONTOUCH, NoteMessage::AUTOMATIONLATCH,
+		NoteMessage::GROUP,
+		NoteMessage::UTILITIESSAVE, NoteMessage::UTILITIESUNDO,
+		NoteMessage::UTILITIESCANCEL, NoteMessage::UTILITIESENTER,
+		NoteMessage::MARKER,
+		NoteMessage::NUDGE,
+		NoteMessage::CYCLE,
+		NoteMessage::DROP,
+		NoteMessage::REPLACE,
+		NoteMessage::CLICK,
+		NoteMessage::SOLO,
+		NoteMessage::REWIND, NoteMessage::FASTFWD, NoteMessage::STOP, NoteMessage::PLAY, NoteMessage::RECORD,
+		NoteMessage::CursorUp, NoteMessage::CursorDown, NoteMessage::CursorLeft, NoteMessage::CursorRight,
+		NoteMessage::Zoom,
+		NoteMessage::Scrub,
+		NoteMessage::UserSwitchA, NoteMessage::UserSwitchB,
+		NoteMessage::FaderTouchCh1, NoteMessage::FaderTouchCh2,
+		NoteMessage::FaderTouchCh3, NoteMessage::FaderTouchCh4,
+		NoteMessage::FaderTouchCh5, NoteMessage::FaderTouchCh6,
+		NoteMessage::FaderTouchCh7, NoteMessage::FaderTouchCh8,
+		NoteMessage::FaderTouchMaster,
+		NoteMessage::SMPTELED,
+		NoteMessage::BEATSLED,
+		NoteMessage::RUDESOLOLIGHT,
+		NoteMessage::Relayclick
+		});
+	/**
+	 * Lookup table of valid NoteMessage values.
+	 */
+	inline constexpr auto validNoteMessageTable = makeValidTable(validNoteMessage);
 	/**
 	 * Check if the message is valid.
 	 */
-	constexpr bool MACKIE_API isValidNoteMessage(NoteMessage mes);
+	constexpr bool MACKIE_API isValidNoteMessage(NoteMessage mes) {
+		auto value = static_cast<int>(mes);
+		return value >= 0 && value < static_cast<int>(validNoteMessageTable.size()) && validNoteMessageTable[value];
+	}
 	/**
 	 * Check if the message is valid.
 	 */
-	constexpr bool MACKIE_API isValidNoteMessage(int mes);
+	constexpr bool MACKIE_API isValidNoteMessage(int mes) {
+		return isValidNoteMessage(static_cast<NoteMessage>(mes));
+	}
 
 	/**
 	 * Mackie Control messages via MIDI controller message controller number data.
@@ -131,14 +257,122 @@ namespace mackieControl {
 		TimeCodeBBTDisplay9, TimeCodeBBTDisplay10,
 		Assignment7SegmentDisplay1, Assignment7SegmentDisplay2, Assignment7SegmentDisplay3
 	};
+	/**
+	 * All valid CCMessage values.
+	 */
+	inline constexpr auto validCCMessage = std::to_array({
+		CCMessage::VPot1, CCMessage::VPot2, CCMessage::VPot3, CCMessage::VPot4,
+		CCMessage::VPot5, CCMessage::VPot6, CCMessage::VPot7, CCMessage::VPot8,
+		CCMessage::ExternalController,
+		CCMessage::VPotLEDRing1, CCMessage::VPotLEDRing2, CCMessage::VPotLEDRing3, CCMessage::VPotLEDRing4,
+		CCMessage::VPotLEDRing5, CCMessage::VPotLEDRing6, CCMessage::VPotLEDRing7, CCMessage::VPotLEDRing8,
+		CCMessage::JogWheel,
+		CCMessage::TimeCodeBBTDisplay1, CCMessage::TimeCodeBBTDisplay2,
+		CCMessage::TimeCodeBBTDisplay3, CCMessage::TimeCodeBBTDisplay4,
+		CCMessage::TimeCodeBBTDisplay5, CCMessage::TimeCodeBBTDisplay6,
+		CCMessage::TimeCodeBBTDisplay7, CCMessage::TimeCodeBBTDisplay8,
+		CCMessage::TimeCodeBBTDisplay9, CCMessage::TimeCodeBBTDisplay10,
+		CCMessage::Assignment7SegmentDisplay1, CCMessage::Assignment7SegmentDisplay2,
+		CCMessage::Assignment7SegmentDisplay3
+		});
+	/**
+	 * Lookup table of valid CCMessage values.
+	 */
+	inline constexpr auto validCCMessageTable = makeValidTable(validCCMessage);
 	/**
 	 * Check if the message is valid.
 	 */
-	constexpr bool MACKIE_API isValidCCMessage(CCMessage mes);
+	constexpr bool MACKIE_API isValidCCMessage(CCMessage mes) {
+		auto value = static_cast<int>(mes);
+		return value >= 0 && value < static_cast<int>(validCCMessageTable.size()) && validCCMessageTable[value];
+	}
 	/**
 	 * Check if the message is valid.
 	 */
-	constexpr bool MACKIE_API isValidCCMessage(int mes);
+	constexpr bool MACKIE_API isValidCCMessage(int mes) {
+		return isValidCCMessage(static_cast<CCMessage>(mes));
+	}
+
+	/**
+	 * Kind of Mackie Control message.
+	 */
+	enum class MACKIE_API MessageType : uint8_t {
+		Invalid = 0,
+		SysEx,
+		Note,
+		CC,
+		PitchWheel,
+		ChannelPressure
+	};
+
+	/**
+	 * Create the lookup table from MIDI status byte to the kind of Mackie Control message.
+	 */
+	constexpr std::array<MessageType, 256> makeMessageStatusTable() {
+		std::array<MessageType, 256> result{};
+		for (int i = 0; i < 16; i++) {
+			result[0x80 + i] = MessageType::Note;
+			result[0x90 + i] = MessageType::Note;
+			result[0xB0 + i] = MessageType::CC;
+			result[0xD0 + i] = MessageType::ChannelPressure;
+		}
+		for (int i = 0; i < 9; i++) {
+			result[0xE0 + i] = MessageType::PitchWheel;
+		}
+		result[0xF0] = MessageType::SysEx;
+		return result;
+	}
+	/**
+	 * Create the lookup tables from data byte to validity for every kind of Mackie Control message.
+	 * \param secondByte	Table of the second data byte
+	 */
+	constexpr std::array<std::array<bool, 256>, 6> makeMessageDataTable(bool secondByte) {
+		std::array<std::array<bool, 256>, 6> result{};
+		for (int i = 0; i < 256; i++) {
+			result[static_cast<int>(MessageType::SysEx)][i] = secondByte || validSysExMessageTable[i];
+			result[static_cast<int>(MessageType::Note)][i] = secondByte ? validVelocityMessageTable[i] : validNoteMessageTable[i];
+			result[static_cast<int>(MessageType::CC)][i] = secondByte || validCCMessageTable[i];
+			result[static_cast<int>(MessageType::PitchWheel)][i] = true;
+			result[static_cast<int>(MessageType::ChannelPressure)][i] = true;
+		}
+		return result;
+	}
+	/**
+	 * Lookup table from MIDI status byte to the kind of Mackie Control message.
+	 */
+	inline constexpr auto messageStatusTable = makeMessageStatusTable();
+	/**
+	 * Lookup tables of valid first data byte. The first data byte of MIDI system exclusive message is sysExData[4].
+	 */
+	inline constexpr auto messageData1Table = makeMessageDataTable(false);
+	/**
+	 * Lookup tables of valid second data byte.
+	 */
+	inline constexpr auto messageData2Table = makeMessageDataTable(true);
+
+	/**
+	 * Get the kind of Mackie Control message in constant time.
+	 * \param status		Status Byte
+	 * \param data1			First Data Byte (sysExData[4] of MIDI system exclusive message)
+	 * \param data2			Second Data Byte
+	 */
+	constexpr MessageType MACKIE_API classifyMessage(uint8_t status, uint8_t data1, uint8_t data2) {
+		auto type = messageStatusTable[status];
+		auto index = static_cast<uint8_t>(type);
+		return (messageData1Table[index][data1] && messageData2Table[index][data2]) ? type : MessageType::Invalid;
+	}
+	/**
+	 * Get the kind of Mackie Control message from raw MIDI bytes in constant time.
+	 * \param data			Data Pointer
+	 * \param size			Data Size
+	 */
+	constexpr MessageType MACKIE_API classifyMessage(const uint8_t* data, int size) {
+		if (size < 2) { return MessageType::Invalid; }
+		if (data[0] == 0xF0) {
+			return (size >= 1 + 5 + 1) ? classifyMessage(data[0], data[1 + 4], 0) : MessageType::Invalid;
+		}
+		return classifyMessage(data[0], data[1], (size >= 3) ? data[2] : 0);
+	}
 
 	/**
 	 * Rotation direction of wheel messages.
@@ -197,6 +431,14 @@ namespace mackieControl {
 		 * Convert this message to MIDI message.
 		 */
 		juce::MidiMessage toMidi() const;
+		/**
+		 * Get the raw MIDI bytes of this message.
+		 */
+		const uint8_t* getRawData() const;
+		/**
+		 * Get the raw MIDI bytes size of this message.
+		 */
+		int getRawDataSize() const;
 
 		/**
 		 * Check if this message is a valid Mackie Control message via MIDI system exclusive message.
@@ -223,6 +465,10 @@ namespace mackieControl {
 		 * Check if this message is a valid Mackie Control message.
 		 */
 		bool isMackieControl() const;
+		/**
+		 * Get the kind of this Mackie Control message.
+		 */
+		MessageType getType() const;
 
 		/**
 		 * Get the type of Mackie Control message via MIDI system exclusive message.
@@ -448,6 +694,76 @@ namespace mackieControl {
 		 */
 		static Message createChannelPressure(int channel, int value);
 
+		/**
+		 * Write a Time Code/BBT Display message (including 0xF0 and 0xF7) into the buffer without allocation.
+		 * \param dest			Destination Buffer
+		 * \param data			Data Pointer (Mackie Control Character)
+		 * \param size			Data Size
+		 * \return	Written Size, 0 if the buffer is too small
+		 */
+		static int writeTimeCodeBBTDisplay(std::span<uint8_t> dest, const uint8_t* data, int size);
+		/**
+		 * Write an LCD message (including 0xF0 and 0xF7) into the buffer without allocation.
+		 * \param dest			Destination Buffer
+		 * \param place			Line Place
+		 * \param data			Data Pointer
+		 * \param size			Data Size
+		 * \return	Written Size, 0 if the buffer is too small
+		 */
+		static int writeLCD(std::span<uint8_t> dest, uint8_t place, const char* data, int size);
+		/**
+		 * Write a Version Reply message (including 0xF0 and 0xF7) into the buffer without allocation.
+		 * \param dest			Destination Buffer
+		 * \param data			Data Pointer
+		 * \param size			Data Size
+		 * \return	Written Size, 0 if the buffer is too small
+		 */
+		static int writeVersionReply(std::span<uint8_t> dest, const char* data, int size);
+		/**
+		 * Append a Time Code/BBT Display message to the MIDI buffer.
+		 * This doesn't allocate unless the MIDI buffer grows.
+		 * \param buffer		MIDI Buffer
+		 * \param samplePosition	Sample Position
+		 * \param data			Data Pointer (Mackie Control Character)
+		 * \param size			Data Size
+		 */
+		static bool addTimeCodeBBTDisplay(juce::MidiBuffer& buffer, int samplePosition, const uint8_t* data, int size);
+		/**
+		 * Append an LCD message to the MIDI buffer.
+		 * This doesn't allocate unless the MIDI buffer grows.
+		 * \param buffer		MIDI Buffer
+		 * \param samplePosition	Sample Position
+		 * \param place			Line Place
+		 * \param data			Data Pointer
+		 * \param size			Data Size
+		 */
+		static bool addLCD(juce::MidiBuffer& buffer, int samplePosition, uint8_t place, const char* data, int size);
+		/**
+		 * Append a Version Reply message to the MIDI buffer.
+		 * This doesn't allocate unless the MIDI buffer grows.
+		 * \param buffer		MIDI Buffer
+		 * \param samplePosition	Sample Position
+		 * \param data			Data Pointer
+		 * \param size			Data Size
+		 */
+		static bool addVersionReply(juce::MidiBuffer& buffer, int samplePosition, const char* data, int size);
+
+		/**
+		 * Get the MIDI size (including 0xF0 and 0xF7) of a Time Code/BBT Display message.
+		 * \param size			Data Size
+		 */
+		static constexpr int getTimeCodeBBTDisplaySize(int size) { return 1 + 5 + 1 + size + 1 + 1; }
+		/**
+		 * Get the MIDI size (including 0xF0 and 0xF7) of an LCD message.
+		 * \param size			Data Size
+		 */
+		static constexpr int getLCDSize(int size) { return 1 + 5 + 1 + size + 1; }
+		/**
+		 * Get the MIDI size (including 0xF0 and 0xF7) of a Version Reply message.
+		 * \param size			Data Size
+		 */
+		static constexpr int getVersionReplySize(int size) { return 1 + 5 + 1 + size + 1; }
+
 		/**
 		 * Convert ASCII character to Mackie Control character.
 		 */
@@ -27,6 +27,10 @@
 #define MACKIE_Call
 #endif
 
+#if defined (__SSE2__) || defined (_M_X64) || (defined (_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MACKIE_SSE2 1
+#endif
+
 #if MACKIE_DLL_BUILD
 #define MACKIE_API MACKIE_Export
 #elif MACKIE_DLL
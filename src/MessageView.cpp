@@ -0,0 +1,219 @@
+/*****************************************************************//**
+ * \file	MessageView.cpp
+ * \brief	A non-owning Mackie Control message view on raw MIDI bytes.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ *********************************************************************/
+
+#include "MessageView.h"
+
+namespace mackieControl {
+	MessageView::MessageView(const Message& message)
+		: MessageView(message.getRawData(), message.getRawDataSize()) {}
+
+	Message MessageView::toMessage() const {
+		if (this->data.empty()) { return Message{}; }
+		return Message{ juce::MidiMessage{ this->data.data(), static_cast<int>(this->data.size()) } };
+	}
+
+	bool MessageView::isSysEx() const {
+		return this->getType() == MessageType::SysEx;
+	}
+
+	bool MessageView::isNote() const {
+		return this->getType() == MessageType::Note;
+	}
+
+	bool MessageView::isCC() const {
+		return this->getType() == MessageType::CC;
+	}
+
+	bool MessageView::isPitchWheel() const {
+		return this->getType() == MessageType::PitchWheel;
+	}
+
+	bool MessageView::isChannelPressure() const {
+		return this->getType() == MessageType::ChannelPressure;
+	}
+
+	bool MessageView::isMackieControl() const {
+		return this->getType() != MessageType::Invalid;
+	}
+
+	MessageType MessageView::getType() const {
+		return classifyMessage(this->data.data(), static_cast<int>(this->data.size()));
+	}
+
+	std::tuple<SysExMessage> MessageView::getSysExData() const {
+		if (this->getSysExDataSize() < 5) { return { static_cast<SysExMessage>(-1) }; }
+		return { static_cast<SysExMessage>(this->getSysExDataPtr()[4]) };
+	}
+
+	std::tuple<std::array<uint8_t, 7>, uint32_t> MessageView::getHostConnectionQueryData() const {
+		if (this->getSysExDataSize() <
+			static_cast<int>(5 + sizeof(std::array<uint8_t, 7>) + sizeof(uint32_t))) { return std::tuple<std::array<uint8_t, 7>, uint32_t>{}; }
+
+		std::array<uint8_t, 7> bytes;
+		std::memcpy(bytes.data(), &(this->getSysExDataPtr()[5]), sizeof(bytes));
+
+		uint32_t code;
+		std::memcpy(&code, &(this->getSysExDataPtr()[5 + sizeof(bytes)]), sizeof(code));
+
+		return { bytes, code };
+	}
+
+	std::tuple<std::array<uint8_t, 7>, uint32_t> MessageView::getHostConnectionReplyData() const {
+		if (this->getSysExDataSize() <
+			static_cast<int>(5 + sizeof(std::array<uint8_t, 7>) + sizeof(uint32_t))) {
+			return std::tuple<std::array<uint8_t, 7>, uint32_t>{};
+		}
+
+		std::array<uint8_t, 7> bytes;
+		std::memcpy(bytes.data(), &(this->getSysExDataPtr()[5]), sizeof(bytes));
+
+		uint32_t code;
+		std::memcpy(&code, &(this->getSysExDataPtr()[5 + sizeof(bytes)]), sizeof(code));
+
+		return { bytes, code };
+	}
+
+	std::tuple<std::array<uint8_t, 7>> MessageView::getHostConnectionConfirmationData() const {
+		if (this->getSysExDataSize() < static_cast<int>(5 + sizeof(std::array<uint8_t, 7>))) {
+			return std::tuple<std::array<uint8_t, 7>>{};
+		}
+
+		std::array<uint8_t, 7> bytes;
+		std::memcpy(bytes.data(), &(this->getSysExDataPtr()[5]), sizeof(bytes));
+
+		return { bytes };
+	}
+
+	std::tuple<std::array<uint8_t, 7>> MessageView::getHostConnectionErrorData() const {
+		if (this->getSysExDataSize() < static_cast<int>(5 + sizeof(std::array<uint8_t, 7>))) {
+			return std::tuple<std::array<uint8_t, 7>>{};
+		}
+
+		std::array<uint8_t, 7> bytes;
+		std::memcpy(bytes.data(), &(this->getSysExDataPtr()[5]), sizeof(bytes));
+
+		return { bytes };
+	}
+
+	std::tuple<uint8_t, uint8_t> MessageView::getLCDBackLightSaverData() const {
+		if (this->getSysExDataSize() < 5 + 1) {
+			return std::tuple<uint8_t, uint8_t>{};
+		}
+
+		return { static_cast<uint8_t>(this->getSysExDataPtr()[5]),
+			(this->getSysExDataSize() >= 7) ? static_cast<uint8_t>(this->getSysExDataPtr()[6]) : 0 };
+	}
+
+	std::tuple<uint8_t> MessageView::getTouchlessMovableFadersData() const {
+		if (this->getSysExDataSize() < 5 + 1) {
+			return std::tuple<uint8_t>{};
+		}
+
+		return { static_cast<uint8_t>(this->getSysExDataPtr()[5]) };
+	}
+
+	std::tuple<uint8_t, uint8_t> MessageView::getFaderTouchSensitivityData() const {
+		if (this->getSysExDataSize() < 5 + 2) {
+			return std::tuple<uint8_t, uint8_t>{};
+		}
+
+		return { static_cast<uint8_t>(this->getSysExDataPtr()[5]),
+			static_cast<uint8_t>(this->getSysExDataPtr()[6]) };
+	}
+
+	std::tuple<const uint8_t*, int> MessageView::getTimeCodeBBTDisplayData() const {
+		if (this->getSysExDataSize() < 5 + 1 + 1 + 1) {
+			return std::tuple<uint8_t*, int>{};
+		}
+
+		return { &(this->getSysExDataPtr()[6]),
+			this->getSysExDataSize() - 1 - 6 };
+	}
+
+	std::tuple<std::array<uint8_t, 2>> MessageView::getAssignment7SegmentDisplayData() const {
+		if (this->getSysExDataSize() < static_cast<int>(5 + 1 + sizeof(std::array<uint8_t, 2>))) {
+			return std::tuple<std::array<uint8_t, 2>>{};
+		}
+
+		std::array<uint8_t, 2> bytes;
+		std::memcpy(bytes.data(), &(this->getSysExDataPtr()[6]), sizeof(bytes));
+
+		return { bytes };
+	}
+
+	std::tuple<uint8_t, const char*, int> MessageView::getLCDData() const {
+		if (this->getSysExDataSize() < 5 + 1 + 1) {
+			return std::tuple<uint8_t, char*, int>{};
+		}
+
+		return { static_cast<uint8_t>(this->getSysExDataPtr()[5]),
+			reinterpret_cast<const char*>(&(this->getSysExDataPtr()[6])) ,
+			this->getSysExDataSize() - 6 };
+	}
+
+	std::tuple<const char*, int> MessageView::getVersionReplyData() const {
+		if (this->getSysExDataSize() < 5 + 1 + 1) {
+			return std::tuple<char*, int>{};
+		}
+
+		return { reinterpret_cast<const char*>(&(this->getSysExDataPtr()[6])) ,
+			this->getSysExDataSize() - 6 };
+	}
+
+	std::tuple<uint8_t, uint8_t> MessageView::getChannelMeterModeData() const {
+		if (this->getSysExDataSize() < 5 + 2) {
+			return std::tuple<uint8_t, uint8_t>{};
+		}
+
+		return { static_cast<uint8_t>(this->getSysExDataPtr()[5]),
+			static_cast<uint8_t>(this->getSysExDataPtr()[6]) };
+	}
+
+	std::tuple<uint8_t> MessageView::getGlobalLCDMeterModeData() const {
+		if (this->getSysExDataSize() < 5 + 1) {
+			return std::tuple<uint8_t>{};
+		}
+
+		return { static_cast<uint8_t>(this->getSysExDataPtr()[5]) };
+	}
+
+	std::tuple<NoteMessage, VelocityMessage> MessageView::getNoteData() const {
+		return { static_cast<NoteMessage>(this->getByte(1)),
+			static_cast<VelocityMessage>(this->getByte(2)) };
+	}
+
+	std::tuple<CCMessage, int> MessageView::getCCData() const {
+		return { static_cast<CCMessage>(this->getByte(1)),
+			this->getByte(2) };
+	}
+
+	std::tuple<int, int> MessageView::getPitchWheelData() const {
+		return { (this->getByte(0) & 0x0F) + 1,
+			this->getByte(1) | (this->getByte(2) << 7) };
+	}
+
+	std::tuple<int, int> MessageView::getChannelPressureData() const {
+		int value = this->getByte(1);
+		return { value / 16 + 1,value % 16 };
+	}
+
+	uint8_t MessageView::getByte(int index) const {
+		return (index < static_cast<int>(this->data.size())) ? this->data[index] : 0;
+	}
+
+	const uint8_t* MessageView::getSysExDataPtr() const {
+		return this->data.data() + 1;
+	}
+
+	int MessageView::getSysExDataSize() const {
+		if (this->data.size() < 2 || this->data[0] != 0xF0) { return 0; }
+		return static_cast<int>(this->data.size()) - 2;
+	}
+}
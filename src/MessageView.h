@@ -0,0 +1,189 @@
+﻿/*****************************************************************//**
+ * \file	MessageView.h
+ * \brief	A non-owning Mackie Control message view on raw MIDI bytes.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ *********************************************************************/
+
+#pragma once
+
+#include "MackieControl.h"
+
+namespace mackieControl {
+	/**
+	 * Mackie Control message view on raw MIDI bytes.
+	 * The view doesn't copy or own the bytes, so the bytes must outlive the view.
+	 */
+	class MACKIE_API MessageView final {
+	public:
+		/**
+		 * Create an empty view. An empty view is an invalid Mackie Control message.
+		 */
+		constexpr MessageView() = default;
+		/**
+		 * Create a view on raw MIDI bytes (including 0xF0 and 0xF7 of MIDI system exclusive message).
+		 */
+		constexpr explicit MessageView(std::span<const uint8_t> data)
+			: data(data) {}
+		/**
+		 * Create a view on raw MIDI bytes (including 0xF0 and 0xF7 of MIDI system exclusive message).
+		 * \param data			Data Pointer
+		 * \param size			Data Size
+		 */
+		constexpr MessageView(const uint8_t* data, int size)
+			: data(data, static_cast<std::size_t>(std::max(size, 0))) {}
+		/**
+		 * Create a view on the bytes of a Mackie Control message.
+		 */
+		explicit MessageView(const Message& message);
+
+		/**
+		 * Get the raw MIDI bytes.
+		 */
+		constexpr std::span<const uint8_t> getRawData() const { return this->data; }
+		/**
+		 * Create an owning Mackie Control message from this view.
+		 */
+		Message toMessage() const;
+
+		/**
+		 * Check if this message is a valid Mackie Control message via MIDI system exclusive message.
+		 */
+		bool isSysEx() const;
+		/**
+		 * Check if this message is a valid Mackie Control message via MIDI note message.
+		 */
+		bool isNote() const;
+		/**
+		 * Check if this message is a valid Mackie Control message via MIDI controller message.
+		 */
+		bool isCC() const;
+		/**
+		 * Check if this message is a valid Mackie Control message via MIDI pitch wheel message.
+		 */
+		bool isPitchWheel() const;
+		/**
+		 * Check if this message is a valid Mackie Control message via MIDI channel pressure message.
+		 */
+		bool isChannelPressure() const;
+
+		/**
+		 * Check if this message is a valid Mackie Control message.
+		 */
+		bool isMackieControl() const;
+		/**
+		 * Get the kind of this Mackie Control message.
+		 */
+		MessageType getType() const;
+
+		/**
+		 * Get the type of Mackie Control message via MIDI system exclusive message.
+		 * \return	Message Type
+		 */
+		std::tuple<SysExMessage> getSysExData() const;
+		/**
+		 * Get the Host Connection Query message data.
+		 * \return	Serial Number, Challenge Code
+		 */
+		std::tuple<std::array<uint8_t, 7>, uint32_t> getHostConnectionQueryData() const;
+		/**
+		 * Get the Host Connection Reply message data.
+		 * \return	Serial Number, Response Code
+		 */
+		std::tuple<std::array<uint8_t, 7>, uint32_t> getHostConnectionReplyData() const;
+		/**
+		 * Get the Host Connection Confirmation message data.
+		 * \return	Serial Number
+		 */
+		std::tuple<std::array<uint8_t, 7>> getHostConnectionConfirmationData() const;
+		/**
+		 * Get the Host Connection Error message data.
+		 * \return	Serial Number
+		 */
+		std::tuple<std::array<uint8_t, 7>> getHostConnectionErrorData() const;
+		/**
+		 * Get the LCD Back Light Saver message data.
+		 * \return	Back Light On/Off, Timeout
+		 */
+		std::tuple<uint8_t, uint8_t> getLCDBackLightSaverData() const;
+		/**
+		 * Get the Touchless Movable Faders message data.
+		 * \return	Touch On/Off
+		 */
+		std::tuple<uint8_t> getTouchlessMovableFadersData() const;
+		/**
+		 * Get the Fader Touch Sensitivity message data.
+		 * \return	 Channel Number, Value
+		 */
+		std::tuple<uint8_t, uint8_t> getFaderTouchSensitivityData() const;
+		/**
+		 * Get the Time Code/BBT Display message data.
+		 * \return	Data Pointer, Data Size
+		 */
+		std::tuple<const uint8_t*, int> getTimeCodeBBTDisplayData() const;
+		/**
+		 * Get the Assignment 7-Segment Display message data.
+		 * \return	Data
+		 */
+		std::tuple<std::array<uint8_t, 2>> getAssignment7SegmentDisplayData() const;
+		/**
+		 * Get the LCD message data.
+		 * \return	Line Place, Data Pointer, Data Size
+		 */
+		std::tuple<uint8_t, const char*, int> getLCDData() const;
+		/**
+		 * Get the Version Reply message data.
+		 * \return	Value Pointer, Value Size
+		 */
+		std::tuple<const char*, int> getVersionReplyData() const;
+		/**
+		 * Get the Channel Meter Mode message data.
+		 * \return	Channel Number, Mode
+		 */
+		std::tuple<uint8_t, uint8_t> getChannelMeterModeData() const;
+		/**
+		 * Get the Global LCD Meter Mode message data.
+		 * \return	Horizontal/Vertical Mode
+		 */
+		std::tuple<uint8_t> getGlobalLCDMeterModeData() const;
+		/**
+		 * Get the type of Mackie Control message via MIDI note message.
+		 * \return	Message Type, Message On/Off Type
+		 */
+		std::tuple<NoteMessage, VelocityMessage> getNoteData() const;
+		/**
+		 * Get the type of Mackie Control message via MIDI controller message.
+		 * \return	Message Type, Value
+		 */
+		std::tuple<CCMessage, int> getCCData() const;
+		/**
+		 * Get the type of Mackie Control message via MIDI pitch wheel message.
+		 * \return	Channel Number, Fader Value
+		 */
+		std::tuple<int, int> getPitchWheelData() const;
+		/**
+		 * Get the type of Mackie Control message via MIDI channel pressure message.
+		 * \return	Meter Channel Number, Meter Value
+		 */
+		std::tuple<int, int> getChannelPressureData() const;
+
+	private:
+		std::span<const uint8_t> data;
+
+		/**
+		 * Get the byte at index of raw MIDI bytes, or 0 if out of range.
+		 */
+		uint8_t getByte(int index) const;
+		/**
+		 * Get the system exclusive data (without 0xF0 and 0xF7).
+		 */
+		const uint8_t* getSysExDataPtr() const;
+		/**
+		 * Get the system exclusive data size (without 0xF0 and 0xF7).
+		 */
+		int getSysExDataSize() const;
+	};
+}
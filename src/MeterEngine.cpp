@@ -0,0 +1,223 @@
+/*****************************************************************//**
+ * \file	MeterEngine.cpp
+ * \brief	Host-side meter engine feeding Mackie Control channel pressure meters.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ *********************************************************************/
+
+#include "MeterEngine.h"
+
+#if MACKIE_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace mackieControl {
+	/** Lowest dB of each meter step from 1 to 12. */
+	constexpr std::array<float, MeterEngine::maxStep> stepDecibels = {
+		-60.f, -50.f, -40.f, -30.f, -20.f, -14.f, -10.f, -8.f, -6.f, -4.f, -2.f, 0.f };
+	/** Lowest gain of each meter step from 1 to 12. */
+	static const std::array<float, MeterEngine::maxStep> stepThresholds = [] {
+		std::array<float, MeterEngine::maxStep> result{};
+		for (int i = 0; i < MeterEngine::maxStep; i++) {
+			result[i] = juce::Decibels::decibelsToGain(stepDecibels[i], -1000.f);
+		}
+		return result;
+		}();
+	/** Meter value of channel pressure message turning on the overload LED. */
+	constexpr uint8_t overloadOn = 0x0E;
+	/** Meter value of channel pressure message turning off the overload LED. */
+	constexpr uint8_t overloadOff = 0x0F;
+	/** Sentinel of unknown sent states. */
+	constexpr uint8_t unknown = 0xFF;
+
+	MeterEngine::MeterEngine(int numStrips, double decayTime, double peakHoldTime) {
+		numStrips = std::max(numStrips, 0);
+		this->display.resize(numStrips, 0.f);
+		this->peaks.resize(numStrips, 0);
+		this->peakTimes.resize(numStrips, 0.f);
+		this->overloads.resize(numStrips, 0);
+		this->sentSteps.resize(numStrips, unknown);
+		this->sentOverloads.resize(numStrips, unknown);
+
+		this->setDecayTime(decayTime);
+		this->setPeakHoldTime(peakHoldTime);
+	}
+
+	void MeterEngine::setDecayTime(double decayTime) {
+		this->decayTime = std::max(decayTime, 0.0);
+	}
+
+	void MeterEngine::setPeakHoldTime(double peakHoldTime) {
+		this->peakHoldTime = std::max(peakHoldTime, 0.0);
+	}
+
+	int MeterEngine::getNumStrips() const {
+		return static_cast<int>(this->display.size());
+	}
+
+	int MeterEngine::getNumUnits() const {
+		return (this->getNumStrips() + stripsPerUnit - 1) / stripsPerUnit;
+	}
+
+	void MeterEngine::process(std::span<const float> levels, double elapsed) {
+		int size = static_cast<int>(std::min<size_t>(levels.size(), this->display.size()));
+		elapsed = std::max(elapsed, 0.0);
+
+		// Zero decay time drops the meters at once
+		float fall = (this->decayTime > 0) ? static_cast<float>(maxStep * elapsed / this->decayTime) : static_cast<float>(maxStep);
+		int i = 0;
+
+#if MACKIE_SSE2
+		__m128 fallx = _mm_set1_ps(fall);
+		__m128 overloadx = _mm_set1_ps(1.f);
+		for (; i + 4 <= size; i += 4) {
+			__m128 x = _mm_loadu_ps(&levels[i]);
+
+			// Each passed threshold is a mask of -1, so subtracting the masks counts the steps
+			__m128i step = _mm_setzero_si128();
+			for (auto threshold : stepThresholds) {
+				step = _mm_sub_epi32(step, _mm_castps_si128(_mm_cmpge_ps(x, _mm_set1_ps(threshold))));
+			}
+
+			__m128 decayed = _mm_sub_ps(_mm_loadu_ps(&this->display[i]), fallx);
+			_mm_storeu_ps(&this->display[i], _mm_max_ps(_mm_cvtepi32_ps(step), decayed));
+
+			int overloaded = _mm_movemask_ps(_mm_cmpge_ps(x, overloadx));
+			for (int j = 0; j < 4; j++) {
+				this->overloads[i + j] |= static_cast<uint8_t>((overloaded >> j) & 1);
+			}
+		}
+#endif
+
+		for (; i < size; i++) {
+			float step = static_cast<float>(MeterEngine::toStep(levels[i]));
+			this->display[i] = std::max(step, this->display[i] - fall);
+			this->overloads[i] |= static_cast<uint8_t>(levels[i] >= 1.f);
+		}
+
+		// Strips without a level in this block only decay
+		for (; i < this->getNumStrips(); i++) {
+			this->display[i] = std::max(0.f, this->display[i] - fall);
+		}
+
+		for (i = 0; i < this->getNumStrips(); i++) {
+			uint8_t step = static_cast<uint8_t>(this->getStep(i));
+			this->peakTimes[i] -= static_cast<float>(elapsed);
+			if (step >= this->peaks[i] || this->peakTimes[i] <= 0) {
+				if (step >= this->peaks[i]) { this->peakTimes[i] = static_cast<float>(this->peakHoldTime); }
+				this->peaks[i] = step;
+			}
+		}
+	}
+
+	int MeterEngine::toStep(float level) {
+		int step = 0;
+		for (auto threshold : stepThresholds) {
+			step += (level >= threshold) ? 1 : 0;
+		}
+		return step;
+	}
+
+	int MeterEngine::getStep(int strip) const {
+		if (strip < 0 || strip >= this->getNumStrips()) { return 0; }
+
+		// A step is shown until the meter has fallen below it
+		return juce::jlimit(0, maxStep, static_cast<int>(std::ceil(this->display[strip])));
+	}
+
+	int MeterEngine::getPeakStep(int strip) const {
+		if (strip < 0 || strip >= this->getNumStrips()) { return 0; }
+		return this->peaks[strip];
+	}
+
+	bool MeterEngine::isOverloaded(int strip) const {
+		if (strip < 0 || strip >= this->getNumStrips()) { return false; }
+		return this->overloads[strip] != 0;
+	}
+
+	void MeterEngine::clearOverloads() {
+		std::fill(this->overloads.begin(), this->overloads.end(), 0);
+	}
+
+	bool MeterEngine::isDirty(int unit) const {
+		int first = unit * stripsPerUnit;
+		int last = std::min(first + stripsPerUnit, this->getNumStrips());
+		for (int i = std::max(first, 0); i < last; i++) {
+			if (this->getStep(i) != this->sentSteps[i]) { return true; }
+			if (this->overloads[i] != this->sentOverloads[i]) { return true; }
+		}
+		return false;
+	}
+
+	void MeterEngine::invalidate() {
+		std::fill(this->sentSteps.begin(), this->sentSteps.end(), unknown);
+		std::fill(this->sentOverloads.begin(), this->sentOverloads.end(), unknown);
+	}
+
+	int MeterEngine::update(int unit, juce::MidiBuffer& buffer, int samplePosition) {
+		return this->updateTo(unit, [&buffer, samplePosition](const uint8_t* data, int size) {
+			return buffer.addEvent(data, size, samplePosition);
+			});
+	}
+
+	int MeterEngine::update(int unit, std::span<uint8_t> dest) {
+		int used = 0;
+		this->updateTo(unit, [dest, &used](const uint8_t* data, int size) {
+			if (used + size > static_cast<int>(dest.size())) { return false; }
+			std::memcpy(&dest[used], data, size);
+			used += size;
+			return true;
+			});
+		return used;
+	}
+
+	uint64_t MeterEngine::getNumBytesSent() const {
+		return this->numBytesSent;
+	}
+
+	uint64_t MeterEngine::getNumBytesSaved() const {
+		return this->numBytesSaved;
+	}
+
+	template <typename Writer>
+	int MeterEngine::updateTo(int unit, Writer&& writer) {
+		if (unit < 0 || unit >= this->getNumUnits()) { return 0; }
+
+		int first = unit * stripsPerUnit;
+		int last = std::min(first + stripsPerUnit, this->getNumStrips());
+
+		int total = 0;
+		for (int i = first; i < last; i++) {
+			// Same packing as Message::createChannelPressure
+			uint8_t channel = static_cast<uint8_t>((i - first) << 4);
+
+			uint8_t step = static_cast<uint8_t>(this->getStep(i));
+			if (step != this->sentSteps[i]) {
+				uint8_t bytes[2] = { 0xD0, static_cast<uint8_t>(channel | step) };
+				if (!writer(bytes, sizeof(bytes))) { break; }
+
+				this->sentSteps[i] = step;
+				total += sizeof(bytes);
+			}
+
+			uint8_t overload = this->overloads[i];
+			if (overload != this->sentOverloads[i]) {
+				uint8_t bytes[2] = { 0xD0, static_cast<uint8_t>(channel | (overload ? overloadOn : overloadOff)) };
+				if (!writer(bytes, sizeof(bytes))) { break; }
+
+				this->sentOverloads[i] = overload;
+				total += sizeof(bytes);
+			}
+		}
+
+		if (total == 0) { return 0; }
+
+		// Sending every meter means a level and an overload state message for each strip
+		this->numBytesSent += total;
+		this->numBytesSaved += (last - first) * 2 * 2 - total;
+		return total;
+	}
+}
@@ -0,0 +1,134 @@
+﻿/*****************************************************************//**
+ * \file	MeterEngine.h
+ * \brief	Host-side meter engine feeding Mackie Control channel pressure meters.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ *********************************************************************/
+
+#pragma once
+
+#include "MackieControl.h"
+
+namespace mackieControl {
+	/**
+	 * Converts blocks of per-strip levels into Mackie Control meter steps and sends only the steps which changed.
+	 * Levels are compared with the dB thresholds of the meter steps converted to gain, so no logarithm is taken,
+	 * and 4 strips are converted at once with SSE2 when available.
+	 * Steps fall with a constant decay like the meters of the surface, and the peak of each strip is held for a while.
+	 * Strips are indices from 0, strip i is on unit i / 8 with local channel i % 8 + 1.
+	 */
+	class MACKIE_API MeterEngine final {
+	public:
+		/** Count of strips of each unit. */
+		static constexpr int stripsPerUnit = 8;
+		/** Highest meter step (0 dB). */
+		static constexpr int maxStep = 12;
+
+		/**
+		 * Create a meter engine. All meters start at step 0 and are unknown to the surface.
+		 * \param numStrips		Count of strips
+		 * \param decayTime		Seconds for a meter to fall from the highest step to 0
+		 * \param peakHoldTime	Seconds the peak step is held
+		 */
+		explicit MeterEngine(int numStrips = 8, double decayTime = 1.5, double peakHoldTime = 1.0);
+
+		/**
+		 * Set the seconds for a meter to fall from the highest step to 0.
+		 */
+		void setDecayTime(double decayTime);
+		/**
+		 * Set the seconds the peak step is held.
+		 */
+		void setPeakHoldTime(double peakHoldTime);
+		/**
+		 * Get the count of strips.
+		 */
+		int getNumStrips() const;
+		/**
+		 * Get the count of units.
+		 */
+		int getNumUnits() const;
+
+		/**
+		 * Process a block of levels.
+		 * \param levels		Peak or RMS gain of each strip, levels at or above 1.0 set the overload LED
+		 * \param elapsed		Seconds since the last block
+		 */
+		void process(std::span<const float> levels, double elapsed);
+		/**
+		 * Convert a gain to a meter step.
+		 * \return	Meter Step (0-12)
+		 */
+		static int toStep(float level);
+
+		/**
+		 * Get the displayed meter step of a strip.
+		 */
+		int getStep(int strip) const;
+		/**
+		 * Get the held peak step of a strip.
+		 */
+		int getPeakStep(int strip) const;
+		/**
+		 * Check if the overload LED of a strip is on.
+		 */
+		bool isOverloaded(int strip) const;
+		/**
+		 * Turn off the overload LED of every strip on the next update.
+		 */
+		void clearOverloads();
+
+		/**
+		 * Check if any meter of a unit differs from the last-sent one.
+		 */
+		bool isDirty(int unit) const;
+		/**
+		 * Forget the sent meters, so the next update sends every meter.
+		 */
+		void invalidate();
+
+		/**
+		 * Append the changed meters of a unit to the MIDI buffer.
+		 * \param unit			Unit Index
+		 * \param buffer		MIDI Buffer
+		 * \param samplePosition	Sample Position
+		 * \return	Count of bytes emitted
+		 */
+		int update(int unit, juce::MidiBuffer& buffer, int samplePosition = 0);
+		/**
+		 * Write the changed meters of a unit into the buffer as raw MIDI bytes.
+		 * Meters which don't fit into the buffer stay dirty for the next update.
+		 * \param unit			Unit Index
+		 * \param dest			Destination Buffer
+		 * \return	Count of bytes written
+		 */
+		int update(int unit, std::span<uint8_t> dest);
+
+		/**
+		 * Get the count of bytes sent by this engine.
+		 */
+		uint64_t getNumBytesSent() const;
+		/**
+		 * Get the count of bytes saved compared with sending the level and the overload state of every meter on each update.
+		 */
+		uint64_t getNumBytesSaved() const;
+
+	private:
+		double decayTime = 1.5, peakHoldTime = 1.0;
+
+		std::vector<float> display;
+		std::vector<uint8_t> peaks;
+		std::vector<float> peakTimes;
+		std::vector<uint8_t> overloads;
+		std::vector<uint8_t> sentSteps, sentOverloads;
+		uint64_t numBytesSent = 0, numBytesSaved = 0;
+
+		template <typename Writer>
+		int updateTo(int unit, Writer&& writer);
+
+		JUCE_LEAK_DETECTOR(MeterEngine)
+	};
+}
@@ -0,0 +1,255 @@
+/*****************************************************************//**
+ * \file	OutputScheduler.cpp
+ * \brief	Bandwidth-aware priority output scheduler for one MIDI port.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ *********************************************************************/
+
+#include "OutputScheduler.h"
+
+namespace mackieControl {
+	// Key ranges of coalescable targets
+	constexpr int faderKeyStart = 0;
+	constexpr int noteKeyStart = faderKeyStart + 16;
+	constexpr int ccKeyStart = noteKeyStart + 128;
+	constexpr int meterKeyStart = ccKeyStart + 128;
+	constexpr int lcdKeyStart = meterKeyStart + 16 * 2;
+	constexpr int sysExKeyStart = lcdKeyStart + 128;
+	constexpr int numKeys = sysExKeyStart + 128;
+	constexpr int timeCodeKey = sysExKeyStart + static_cast<int>(SysExMessage::TimeCodeBBTDisplay);
+
+	OutputScheduler::OutputScheduler(int capacity, double bytesPerSecond, int maxBurst)
+		: slots(std::max(capacity, 1)), slotOfKey(numKeys, -1),
+		bytesPerSecond(bytesPerSecond), maxBurst(std::max(maxBurst, maxMessageSize)) {
+		this->freeSlots.reserve(this->slots.size());
+		for (int i = static_cast<int>(this->slots.size()) - 1; i >= 0; i--) {
+			this->freeSlots.push_back(i);
+		}
+		for (auto& queue : this->queues) {
+			queue.slots.resize(this->slots.size());
+		}
+	}
+
+	bool OutputScheduler::push(const MessageView& message) {
+		return this->push(message, OutputScheduler::getPriority(message));
+	}
+
+	bool OutputScheduler::push(const Message& message) {
+		return this->push(MessageView{ message });
+	}
+
+	bool OutputScheduler::push(const MessageView& message, OutputPriority priority) {
+		auto data = message.getRawData();
+		int size = static_cast<int>(data.size());
+		if (size <= 0 || size > maxMessageSize) {
+			this->numDropped++;
+			return false;
+		}
+
+		int key = OutputScheduler::getKey(message);
+		if (key >= 0) {
+			int index = this->slotOfKey[key];
+			if (index >= 0) {
+				auto& slot = this->slots[index];
+
+				// A shorter time code update carries only the changed digits from the right, so merge them into the queued digits
+				if (key == timeCodeKey && size < slot.size) {
+					int numDigits = size - Message::getTimeCodeBBTDisplaySize(0);
+					std::memcpy(&(slot.data[1 + 6]), &data[1 + 6], numDigits);
+					this->numCoalesced++;
+					return true;
+				}
+
+				// A shorter LCD run can't replace a longer one which covers more characters
+				if (key < lcdKeyStart || key >= sysExKeyStart || size >= slot.size) {
+					std::memcpy(slot.data.data(), data.data(), size);
+					slot.size = size;
+					this->numCoalesced++;
+					return true;
+				}
+			}
+		}
+
+		int index = this->allocateSlot(static_cast<int>(priority));
+		if (index < 0) {
+			this->numDropped++;
+			return false;
+		}
+
+		auto& slot = this->slots[index];
+		slot.key = key;
+		slot.size = size;
+		std::memcpy(slot.data.data(), data.data(), size);
+		if (key >= 0) {
+			this->slotOfKey[key] = index;
+		}
+
+		auto& queue = this->queues[static_cast<int>(priority)];
+		queue.slots[(queue.head + queue.count) % queue.slots.size()] = index;
+		queue.count++;
+
+		return true;
+	}
+
+	int OutputScheduler::process(double currentTime, juce::MidiBuffer& buffer, int samplePosition) {
+		if (this->lastTime < 0 || currentTime < this->lastTime) {
+			this->budget = this->maxBurst;
+		}
+		else {
+			this->budget = std::min(this->maxBurst,
+				this->budget + (currentTime - this->lastTime) * this->bytesPerSecond);
+		}
+		this->lastTime = currentTime;
+
+		int total = 0;
+		for (auto& queue : this->queues) {
+			while (queue.count > 0) {
+				int index = queue.slots[queue.head];
+				auto& slot = this->slots[index];
+
+				// Strict priority: stop instead of letting lower classes overtake
+				if (slot.size > this->budget) { return total; }
+
+				buffer.addEvent(slot.data.data(), slot.size, samplePosition);
+				this->budget -= slot.size;
+				this->numBytesSent += slot.size;
+				total += slot.size;
+
+				queue.head = (queue.head + 1) % queue.slots.size();
+				queue.count--;
+				this->releaseSlot(index);
+			}
+		}
+
+		return total;
+	}
+
+	void OutputScheduler::clear() {
+		for (auto& queue : this->queues) {
+			while (queue.count > 0) {
+				this->releaseSlot(queue.slots[queue.head]);
+				queue.head = (queue.head + 1) % queue.slots.size();
+				queue.count--;
+			}
+		}
+	}
+
+	void OutputScheduler::setBytesPerSecond(double bytesPerSecond) {
+		this->bytesPerSecond = bytesPerSecond;
+	}
+
+	double OutputScheduler::getBytesPerSecond() const {
+		return this->bytesPerSecond;
+	}
+
+	int OutputScheduler::getQueueDepth(OutputPriority priority) const {
+		return this->queues[static_cast<int>(priority)].count;
+	}
+
+	int OutputScheduler::getQueueDepth() const {
+		return static_cast<int>(this->slots.size() - this->freeSlots.size());
+	}
+
+	uint64_t OutputScheduler::getNumCoalesced() const {
+		return this->numCoalesced;
+	}
+
+	uint64_t OutputScheduler::getNumDropped() const {
+		return this->numDropped;
+	}
+
+	uint64_t OutputScheduler::getNumBytesSent() const {
+		return this->numBytesSent;
+	}
+
+	OutputPriority OutputScheduler::getPriority(const MessageView& message) {
+		switch (message.getType()) {
+		case MessageType::PitchWheel:
+			return OutputPriority::Fader;
+		case MessageType::Note:
+			return OutputPriority::LED;
+		case MessageType::CC: {
+			int type = static_cast<int>(std::get<0>(message.getCCData()));
+			if (type >= static_cast<int>(CCMessage::TimeCodeBBTDisplay1)
+				&& type <= static_cast<int>(CCMessage::Assignment7SegmentDisplay3)) {
+				return OutputPriority::TimeCode;
+			}
+			return OutputPriority::LED;
+		}
+		case MessageType::ChannelPressure:
+			return OutputPriority::Meter;
+		case MessageType::SysEx:
+			switch (std::get<0>(message.getSysExData())) {
+			case SysExMessage::TimeCodeBBTDisplay:
+			case SysExMessage::Assignment7SegmentDisplay:
+				return OutputPriority::TimeCode;
+			case SysExMessage::LCD:
+				return OutputPriority::LCD;
+			default:
+				return OutputPriority::System;
+			}
+		default:
+			return OutputPriority::System;
+		}
+	}
+
+	int OutputScheduler::allocateSlot(int priority) {
+		if (this->freeSlots.empty()) {
+			// Evict the oldest message of the lowest class which is lower than the new one
+			for (int i = numPriorities - 1; i > priority; i--) {
+				auto& queue = this->queues[i];
+				if (queue.count > 0) {
+					this->releaseSlot(queue.slots[queue.head]);
+					queue.head = (queue.head + 1) % queue.slots.size();
+					queue.count--;
+					this->numDropped++;
+					break;
+				}
+			}
+		}
+		if (this->freeSlots.empty()) { return -1; }
+
+		int index = this->freeSlots.back();
+		this->freeSlots.pop_back();
+		return index;
+	}
+
+	void OutputScheduler::releaseSlot(int index) {
+		auto& slot = this->slots[index];
+		if (slot.key >= 0 && this->slotOfKey[slot.key] == index) {
+			this->slotOfKey[slot.key] = -1;
+		}
+		slot.key = -1;
+		slot.size = 0;
+		this->freeSlots.push_back(index);
+	}
+
+	int OutputScheduler::getKey(const MessageView& message) {
+		auto data = message.getRawData();
+		switch (message.getType()) {
+		case MessageType::PitchWheel:
+			return faderKeyStart + (data[0] & 0x0F);
+		case MessageType::Note:
+			return noteKeyStart + data[1];
+		case MessageType::CC:
+			return ccKeyStart + data[1];
+		case MessageType::ChannelPressure:
+			return meterKeyStart + (data[1] / 16) * 2 + (((data[1] % 16) >= 14) ? 1 : 0);
+		case MessageType::SysEx:
+			switch (std::get<0>(message.getSysExData())) {
+			case SysExMessage::LCD:
+				return lcdKeyStart + (std::get<0>(message.getLCDData()) & 0x7F);
+			case SysExMessage::TimeCodeBBTDisplay:
+			case SysExMessage::Assignment7SegmentDisplay:
+				return sysExKeyStart + data[1 + 4];
+			default:
+				return -1;
+			}
+		default:
+			return -1;
+		}
+	}
+}
@@ -0,0 +1,146 @@
+﻿/*****************************************************************//**
+ * \file	OutputScheduler.h
+ * \brief	Bandwidth-aware priority output scheduler for one MIDI port.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ *********************************************************************/
+
+#pragma once
+
+#include "MessageView.h"
+
+namespace mackieControl {
+	/**
+	 * Priority class of outbound Mackie Control messages, from the highest to the lowest.
+	 */
+	enum class MACKIE_API OutputPriority {
+		System,
+		Fader,
+		LED,
+		TimeCode,
+		Meter,
+		LCD
+	};
+
+	/**
+	 * Output scheduler for one MIDI port.
+	 * Queues outbound messages by priority class and sends them within the byte budget of the port.
+	 * A newer message for the same target replaces the queued one (latest value wins).
+	 * The scheduler isn't thread safe, push and process it on the same thread.
+	 */
+	class MACKIE_API OutputScheduler final {
+	public:
+		/** Count of priority classes. */
+		static constexpr int numPriorities = static_cast<int>(OutputPriority::LCD) + 1;
+		/** Byte rate of a classic 31.25 kbaud MIDI link (10 bits on wire each byte). */
+		static constexpr double midiBytesPerSecond = 31250.0 / 10.0;
+		/** Max size of a queued message (a full LCD message). */
+		static constexpr int maxMessageSize = Message::getLCDSize(112);
+
+		/**
+		 * Create an output scheduler.
+		 * \param capacity		Max count of queued messages
+		 * \param bytesPerSecond	Byte budget of the port
+		 * \param maxBurst		Max bytes sent at once after the port was idle
+		 */
+		explicit OutputScheduler(int capacity = 512,
+			double bytesPerSecond = midiBytesPerSecond, int maxBurst = 256);
+
+		/**
+		 * Queue a message.
+		 * \return	False if the message was dropped
+		 */
+		bool push(const MessageView& message);
+		/**
+		 * Queue a message.
+		 * \return	False if the message was dropped
+		 */
+		bool push(const Message& message);
+		/**
+		 * Queue a message in a specified priority class.
+		 * \return	False if the message was dropped
+		 */
+		bool push(const MessageView& message, OutputPriority priority);
+
+		/**
+		 * Refill the byte budget and append the messages allowed by the budget to the MIDI buffer.
+		 * \param currentTime	Current Time (s)
+		 * \param buffer		MIDI Buffer
+		 * \param samplePosition	Sample Position
+		 * \return	Count of bytes emitted
+		 */
+		int process(double currentTime, juce::MidiBuffer& buffer, int samplePosition = 0);
+		/**
+		 * Drop all queued messages.
+		 */
+		void clear();
+
+		/**
+		 * Set the byte budget of the port.
+		 */
+		void setBytesPerSecond(double bytesPerSecond);
+		/**
+		 * Get the byte budget of the port.
+		 */
+		double getBytesPerSecond() const;
+
+		/**
+		 * Get the count of queued messages in the priority class.
+		 */
+		int getQueueDepth(OutputPriority priority) const;
+		/**
+		 * Get the count of queued messages.
+		 */
+		int getQueueDepth() const;
+		/**
+		 * Get the count of messages replaced by a newer message for the same target.
+		 */
+		uint64_t getNumCoalesced() const;
+		/**
+		 * Get the count of messages dropped because the queue was full.
+		 */
+		uint64_t getNumDropped() const;
+		/**
+		 * Get the count of bytes sent.
+		 */
+		uint64_t getNumBytesSent() const;
+
+		/**
+		 * Get the default priority class of a message.
+		 */
+		static OutputPriority getPriority(const MessageView& message);
+
+	private:
+		struct Slot final {
+			int key = -1;
+			int size = 0;
+			std::array<uint8_t, maxMessageSize> data;
+		};
+
+		struct Queue final {
+			std::vector<int> slots;
+			int head = 0, count = 0;
+		};
+
+		std::vector<Slot> slots;
+		std::vector<int> freeSlots;
+		std::array<Queue, numPriorities> queues;
+		std::vector<int> slotOfKey;
+
+		double bytesPerSecond = midiBytesPerSecond;
+		double budget = 0, maxBurst = 0;
+		double lastTime = -1;
+
+		uint64_t numCoalesced = 0, numDropped = 0, numBytesSent = 0;
+
+		int allocateSlot(int priority);
+		void releaseSlot(int index);
+
+		static int getKey(const MessageView& message);
+
+		JUCE_LEAK_DETECTOR(OutputScheduler)
+	};
+}
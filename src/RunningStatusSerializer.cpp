@@ -0,0 +1,153 @@
+/*****************************************************************//**
+ * \file	RunningStatusSerializer.cpp
+ * \brief	Running status serializer of outbound Mackie Control byte streams.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ *********************************************************************/
+
+#include "RunningStatusSerializer.h"
+
+#include <bitset>
+
+namespace mackieControl {
+	/**
+	 * Get the group of a status byte. Note off messages are grouped with note on messages of the same channel.
+	 */
+	static uint8_t getStatusGroup(uint8_t status) {
+		return ((status & 0xF0) == 0x80) ? static_cast<uint8_t>(status | 0x10) : status;
+	}
+
+	RunningStatusSerializer::RunningStatusSerializer(int reserveMessages) {
+		this->pending.reserve(std::max(reserveMessages, 0));
+	}
+
+	void RunningStatusSerializer::add(const MessageView& message) {
+		auto compact = CompactMessage::fromView(message, &(this->sysEx));
+		if (compact.isMackieControl()) {
+			this->pending.push_back(compact);
+		}
+	}
+
+	void RunningStatusSerializer::add(const Message& message) {
+		this->add(MessageView{ message });
+	}
+
+	int RunningStatusSerializer::flush(std::span<uint8_t> dest) {
+		int size = 0, fullSize = 0;
+		bool overflow = false;
+		this->serialize([&dest, &size, &fullSize, &overflow](std::span<const uint8_t> bytes, int messageSize) {
+			if (overflow || size + bytes.size() > dest.size()) {
+				overflow = true;
+				return;
+			}
+
+			std::memcpy(&dest[size], bytes.data(), bytes.size());
+			size += static_cast<int>(bytes.size());
+			fullSize += messageSize;
+			});
+		if (overflow) { return 0; }
+
+		this->numBytesWritten += size;
+		this->numBytesSaved += fullSize - size;
+		this->clear();
+		return size;
+	}
+
+	int RunningStatusSerializer::getFlushSize() const {
+		int size = 0;
+		this->serialize([&size](std::span<const uint8_t> bytes, int) {
+			size += static_cast<int>(bytes.size());
+			});
+		return size;
+	}
+
+	void RunningStatusSerializer::clear() {
+		this->pending.clear();
+		this->sysEx.clear();
+	}
+
+	int RunningStatusSerializer::getNumPending() const {
+		return static_cast<int>(this->pending.size());
+	}
+
+	void RunningStatusSerializer::setReorderEnabled(bool enabled) {
+		this->reorder = enabled;
+	}
+
+	bool RunningStatusSerializer::isReorderEnabled() const {
+		return this->reorder;
+	}
+
+	uint64_t RunningStatusSerializer::getNumBytesWritten() const {
+		return this->numBytesWritten;
+	}
+
+	uint64_t RunningStatusSerializer::getNumBytesSaved() const {
+		return this->numBytesSaved;
+	}
+
+	double RunningStatusSerializer::getCompressionRatio() const {
+		uint64_t fullSize = this->numBytesWritten + this->numBytesSaved;
+		if (fullSize == 0) { return 1; }
+		return static_cast<double>(this->numBytesWritten) / static_cast<double>(fullSize);
+	}
+
+	template <typename Writer>
+	void RunningStatusSerializer::serialize(Writer&& writer) const {
+		uint8_t runningStatus = 0;
+		auto writeShort = [&writer, &runningStatus](const CompactMessage& message) {
+			auto bytes = message.getView().getRawData();
+			if (bytes[0] == runningStatus) {
+				writer(bytes.subspan(1), static_cast<int>(bytes.size()));
+				return;
+			}
+
+			writer(bytes, static_cast<int>(bytes.size()));
+			runningStatus = bytes[0];
+			};
+
+		int size = static_cast<int>(this->pending.size());
+		int begin = 0;
+		while (begin < size) {
+			if (this->pending[begin].isSysEx()) {
+				auto bytes = this->pending[begin].getView(&(this->sysEx)).getRawData();
+				writer(bytes, static_cast<int>(bytes.size()));
+				runningStatus = 0;
+				begin++;
+				continue;
+			}
+
+			// Segment of short messages up to the next MIDI system exclusive message
+			int end = begin;
+			while (end < size && !this->pending[end].isSysEx()) {
+				end++;
+			}
+
+			if (!this->reorder) {
+				for (int i = begin; i < end; i++) {
+					writeShort(this->pending[i]);
+				}
+				begin = end;
+				continue;
+			}
+
+			// Write the groups in order of first appearance, keeping the order in each group
+			std::bitset<256> written;
+			for (int i = begin; i < end; i++) {
+				uint8_t group = getStatusGroup(this->pending[i].getView().getRawData()[0]);
+				if (written[group]) { continue; }
+				written[group] = true;
+
+				for (int j = i; j < end; j++) {
+					if (getStatusGroup(this->pending[j].getView().getRawData()[0]) == group) {
+						writeShort(this->pending[j]);
+					}
+				}
+			}
+			begin = end;
+		}
+	}
+}
@@ -0,0 +1,94 @@
+﻿/*****************************************************************//**
+ * \file	RunningStatusSerializer.h
+ * \brief	Running status serializer of outbound Mackie Control byte streams.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ *********************************************************************/
+
+#pragma once
+
+#include "CompactMessage.h"
+
+namespace mackieControl {
+	/**
+	 * Serializer of Mackie Control messages into a raw MIDI byte stream with running status.
+	 * Within a flush, messages between two MIDI system exclusive messages are grouped by status byte
+	 * in order of first appearance, so a LED or ring refresh goes out as long runs of data bytes.
+	 * MIDI system exclusive messages are never reordered and cancel the running status.
+	 * Messages of the same status keep their order, and note off messages are grouped with the note on
+	 * messages of the same channel, so messages on the same control always keep their order.
+	 */
+	class MACKIE_API RunningStatusSerializer final {
+	public:
+		/**
+		 * Create a serializer.
+		 * \param reserveMessages	Count of pending messages reserved
+		 */
+		explicit RunningStatusSerializer(int reserveMessages = 512);
+
+		/**
+		 * Add a message to the pending messages. Invalid messages are ignored.
+		 */
+		void add(const MessageView& message);
+		/**
+		 * Add a Mackie Control message to the pending messages. Invalid messages are ignored.
+		 */
+		void add(const Message& message);
+
+		/**
+		 * Write all pending messages into the buffer with running status and clear them.
+		 * \return	Written Size, 0 if the buffer is too small and the pending messages are kept
+		 */
+		int flush(std::span<uint8_t> dest);
+		/**
+		 * Get the count of bytes the pending messages take with running status.
+		 */
+		int getFlushSize() const;
+		/**
+		 * Remove all pending messages.
+		 */
+		void clear();
+		/**
+		 * Get the count of pending messages.
+		 */
+		int getNumPending() const;
+
+		/**
+		 * Enable or disable grouping of messages by status byte.
+		 */
+		void setReorderEnabled(bool enabled);
+		/**
+		 * Check if grouping of messages by status byte is enabled.
+		 */
+		bool isReorderEnabled() const;
+
+		/**
+		 * Get the count of bytes written by this serializer.
+		 */
+		uint64_t getNumBytesWritten() const;
+		/**
+		 * Get the count of bytes saved compared with writing each message in full.
+		 */
+		uint64_t getNumBytesSaved() const;
+		/**
+		 * Get the written size divided by the size without running status, 1 if nothing was written.
+		 */
+		double getCompressionRatio() const;
+
+	private:
+		std::vector<CompactMessage> pending;
+		SysExStore sysEx;
+		bool reorder = true;
+
+		uint64_t numBytesWritten = 0;
+		uint64_t numBytesSaved = 0;
+
+		template <typename Writer>
+		void serialize(Writer&& writer) const;
+
+		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RunningStatusSerializer)
+	};
+}
@@ -0,0 +1,292 @@
+/*****************************************************************//**
+ * \file	SessionHost.cpp
+ * \brief	Host of many Mackie Control surface sessions on a fixed worker pool.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ *********************************************************************/
+
+#include "SessionHost.h"
+
+namespace mackieControl {
+	/** Max count of events handled for one session before the worker moves on to the next session. */
+	constexpr int maxEventsPerRound = 256;
+
+	struct SessionHost::Session final {
+		Session(std::unique_ptr<SurfaceSession> surface, int queueCapacity, int worker)
+			: surface(std::move(surface)), queue(queueCapacity), worker(worker) {}
+
+		std::unique_ptr<SurfaceSession> surface;
+		InboundQueue queue;
+		int worker = 0;
+
+		/** Set while the session is in the ready queue of its worker */
+		std::atomic<bool> scheduled{ false };
+
+		/** Written by the owning worker only */
+		std::atomic<uint64_t> numHandled{ 0 };
+		std::atomic<double> totalLatency{ 0 };
+		std::atomic<double> maxLatency{ 0 };
+	};
+
+	class SessionHost::Worker final : public juce::Thread {
+	public:
+		Worker(int index, double tickInterval)
+			: juce::Thread("Mackie Session Worker " + juce::String{ index }), tickInterval(tickInterval) {}
+		~Worker() override {
+			this->stopThread(1000);
+		}
+
+		std::vector<Session*> sessions;
+
+		void addSession(Session* session) {
+			this->sessions.push_back(session);
+
+			// Rebuild the ready queue with room for every session, keeping the sessions already scheduled
+			auto capacity = this->sessions.size();
+			auto ready = std::make_unique<std::atomic<Session*>[]>(capacity);
+			uint64_t count = 0;
+			while (auto scheduled = this->pop()) {
+				ready[count++].store(scheduled, std::memory_order_relaxed);
+			}
+			for (auto i = count; i < capacity; i++) {
+				ready[i].store(nullptr, std::memory_order_relaxed);
+			}
+
+			this->ready = std::move(ready);
+			this->capacity = capacity;
+			this->head = 0;
+			this->tail.store(count, std::memory_order_relaxed);
+		}
+
+		/**
+		 * Put the session into the ready queue. Called by any producer.
+		 * \return	False if the session is already in the queue, so its worker is already notified
+		 */
+		bool schedule(Session& session) {
+			if (session.scheduled.exchange(true, std::memory_order_acq_rel)) { return false; }
+
+			// Each session is in the queue at most once, so the queue never holds more than its capacity
+			uint64_t position = this->tail.fetch_add(1, std::memory_order_relaxed);
+			this->ready[position % this->capacity].store(&session, std::memory_order_release);
+			return true;
+		}
+
+		void run() override {
+			double nextTick = SessionHost::getCurrentTime() + this->tickInterval;
+			while (!this->threadShouldExit()) {
+				// Only sessions which were pushed to are visited, in the order they were woken
+				while (!this->threadShouldExit()) {
+					auto session = this->pop();
+					if (!session) { break; }
+
+					// Clear the flag before draining, so a push during the drain schedules the session again
+					session->scheduled.exchange(false, std::memory_order_acq_rel);
+					if (this->handle(*session) >= maxEventsPerRound) {
+						this->schedule(*session);
+					}
+				}
+
+				double currentTime = SessionHost::getCurrentTime();
+				if (this->tickInterval > 0 && currentTime >= nextTick) {
+					for (auto session : this->sessions) {
+						session->surface->process(currentTime);
+					}
+					nextTick = currentTime + this->tickInterval;
+				}
+
+				// A session scheduled after the queue was found empty signals the event again
+				this->wait((this->tickInterval > 0) ? std::max((nextTick - currentTime) * 1000, 1.0) : -1);
+			}
+		}
+
+	private:
+		double tickInterval = 0;
+
+		/** Bounded MPSC ring of scheduled sessions, an empty cell is null until its producer publishes it */
+		std::unique_ptr<std::atomic<Session*>[]> ready;
+		uint64_t capacity = 0, head = 0;
+		std::atomic<uint64_t> tail{ 0 };
+
+		Session* pop() {
+			if (this->capacity == 0) { return nullptr; }
+
+			auto session = this->ready[this->head % this->capacity].exchange(nullptr, std::memory_order_acquire);
+			if (session) {
+				this->head++;
+			}
+			return session;
+		}
+
+		int handle(Session& session) {
+			uint64_t count = 0;
+			double total = 0, max = session.maxLatency.load(std::memory_order_relaxed);
+
+			int numPopped = session.queue.pop([&session, &count, &total, &max](const InboundEvent& event, const MessageView& message) {
+				double latency = std::max(SessionHost::getCurrentTime() - event.timeStamp, 0.0);
+				count++;
+				total += latency;
+				max = std::max(max, latency);
+
+				session.surface->handleInput(event, message);
+				}, maxEventsPerRound);
+			if (numPopped == 0) { return 0; }
+
+			session.numHandled.store(session.numHandled.load(std::memory_order_relaxed) + count, std::memory_order_relaxed);
+			session.totalLatency.store(session.totalLatency.load(std::memory_order_relaxed) + total, std::memory_order_relaxed);
+			session.maxLatency.store(max, std::memory_order_relaxed);
+
+			session.surface->process(SessionHost::getCurrentTime());
+			return numPopped;
+		}
+
+		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Worker)
+	};
+
+	SessionHost::SessionHost(int numWorkers, double tickInterval)
+		: tickInterval(std::max(tickInterval, 0.0)) {
+		if (numWorkers <= 0) {
+			numWorkers = juce::SystemStats::getNumCpus();
+		}
+		numWorkers = std::max(numWorkers, 1);
+
+		for (int i = 0; i < numWorkers; i++) {
+			this->workers.push_back(std::make_unique<Worker>(i, this->tickInterval));
+		}
+	}
+
+	SessionHost::~SessionHost() {
+		// Workers must stop before the sessions they run are destroyed
+		this->stop();
+	}
+
+	int SessionHost::addSession(std::unique_ptr<SurfaceSession> session, int queueCapacity) {
+		if (this->running || !session) { return -1; }
+
+		int worker = 0;
+		for (int i = 1; i < this->getNumWorkers(); i++) {
+			if (this->workers[i]->sessions.size() < this->workers[worker]->sessions.size()) {
+				worker = i;
+			}
+		}
+
+		this->sessions.push_back(std::make_unique<Session>(std::move(session), queueCapacity, worker));
+		this->workers[worker]->addSession(this->sessions.back().get());
+		return this->getNumSessions() - 1;
+	}
+
+	int SessionHost::getNumSessions() const {
+		return static_cast<int>(this->sessions.size());
+	}
+
+	int SessionHost::getNumWorkers() const {
+		return static_cast<int>(this->workers.size());
+	}
+
+	int SessionHost::getWorkerOf(int session) const {
+		if (session < 0 || session >= this->getNumSessions()) { return -1; }
+		return this->sessions[session]->worker;
+	}
+
+	void SessionHost::start(bool pinWorkers) {
+		if (this->running) { return; }
+
+		int numCpus = std::clamp(juce::SystemStats::getNumCpus(), 1, 32);
+		for (int i = 0; i < this->getNumWorkers(); i++) {
+			auto& worker = this->workers[i];
+			if (pinWorkers) {
+				worker->setAffinityMask(static_cast<juce::uint32>(1) << (i % numCpus));
+			}
+			worker->startThread();
+		}
+
+		this->running = true;
+	}
+
+	void SessionHost::stop() {
+		if (!this->running) { return; }
+
+		for (auto& worker : this->workers) {
+			worker->stopThread(1000);
+		}
+
+		this->running = false;
+	}
+
+	bool SessionHost::isRunning() const {
+		return this->running;
+	}
+
+	bool SessionHost::push(int session, const MessageView& message, double timeStamp) {
+		if (session < 0 || session >= this->getNumSessions()) { return false; }
+
+		auto& target = *(this->sessions[session]);
+		if (!target.queue.push(message, timeStamp)) { return false; }
+
+		this->wake(target);
+		return true;
+	}
+
+	bool SessionHost::push(int session, const MessageView& message) {
+		return this->push(session, message, SessionHost::getCurrentTime());
+	}
+
+	int SessionHost::push(int session, const juce::MidiBuffer& buffer, double timeStamp, double sampleRate) {
+		if (session < 0 || session >= this->getNumSessions()) { return 0; }
+
+		auto& target = *(this->sessions[session]);
+		int count = target.queue.push(buffer, timeStamp, sampleRate);
+		if (count > 0) {
+			this->wake(target);
+		}
+		return count;
+	}
+
+	double SessionHost::getCurrentTime() {
+		return juce::Time::getMillisecondCounterHiRes() * 0.001;
+	}
+
+	std::tuple<uint64_t, double, double> SessionHost::getLatency(int session) const {
+		if (session < 0 || session >= this->getNumSessions()) { return { 0, 0, 0 }; }
+
+		auto& target = *(this->sessions[session]);
+		uint64_t count = target.numHandled.load(std::memory_order_relaxed);
+		double total = target.totalLatency.load(std::memory_order_relaxed);
+		double max = target.maxLatency.load(std::memory_order_relaxed);
+		return { count, (count > 0) ? (total / count) : 0.0, max };
+	}
+
+	void SessionHost::resetLatency() {
+		for (auto& session : this->sessions) {
+			session->numHandled.store(0, std::memory_order_relaxed);
+			session->totalLatency.store(0, std::memory_order_relaxed);
+			session->maxLatency.store(0, std::memory_order_relaxed);
+		}
+	}
+
+	uint64_t SessionHost::getNumHandled() const {
+		uint64_t count = 0;
+		for (auto& session : this->sessions) {
+			count += session->numHandled.load(std::memory_order_relaxed);
+		}
+		return count;
+	}
+
+	uint64_t SessionHost::getNumDropped() const {
+		uint64_t count = 0;
+		for (auto& session : this->sessions) {
+			count += session->queue.getNumOverflows() + session->queue.getNumOversized();
+		}
+		return count;
+	}
+
+	void SessionHost::wake(Session& session) {
+		// A session already in the ready queue has a pending notification
+		auto& worker = this->workers[session.worker];
+		if (worker->schedule(session)) {
+			worker->notify();
+		}
+	}
+}
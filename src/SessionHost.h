@@ -0,0 +1,151 @@
+﻿/*****************************************************************//**
+ * \file	SessionHost.h
+ * \brief	Host of many Mackie Control surface sessions on a fixed worker pool.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ *********************************************************************/
+
+#pragma once
+
+#include <memory>
+
+#include "InboundQueue.h"
+
+namespace mackieControl {
+	/**
+	 * Independent state of one surface, e.g. a HostConnection with a SurfaceState and a FaderEngine.
+	 * All functions are called on the worker owning the session, so the state needs no locking.
+	 */
+	class MACKIE_API SurfaceSession {
+	public:
+		virtual ~SurfaceSession() = default;
+
+		/**
+		 * Handle an inbound event of the surface.
+		 * \param event			Event
+		 * \param message		Message, valid until the function returns
+		 */
+		virtual void handleInput(const InboundEvent& event, const MessageView& message) = 0;
+		/**
+		 * Called after each batch of inbound events and on each tick of the host.
+		 * \param currentTime	Current Time in Seconds
+		 */
+		virtual void process(double currentTime) { juce::ignoreUnused(currentTime); }
+	};
+
+	/**
+	 * Runs many surface sessions on a fixed pool of worker threads.
+	 * Each session is owned by one worker for its whole life, so its state stays on one core.
+	 * Inbound MIDI is pushed into the queue of the session, which puts the session into the ready queue of its worker.
+	 * Workers visit only the sessions in their ready queue and sleep while it's empty, so idle sessions cost nothing
+	 * but the optional tick.
+	 * Sessions are added before start() and live until the host is destroyed.
+	 */
+	class MACKIE_API SessionHost final {
+	public:
+		/**
+		 * Create a session host.
+		 * \param numWorkers	Count of worker threads, 0 for the count of CPUs
+		 * \param tickInterval	Seconds between calls of SurfaceSession::process on idle sessions, 0 for never
+		 */
+		explicit SessionHost(int numWorkers = 0, double tickInterval = 0);
+		~SessionHost();
+
+		/**
+		 * Add a session. The session is owned by the worker with the fewest sessions.
+		 * \param session		Session
+		 * \param queueCapacity	Max count of queued inbound events of the session
+		 * \return	Session ID, -1 if the host is running
+		 */
+		int addSession(std::unique_ptr<SurfaceSession> session, int queueCapacity = 1024);
+		/**
+		 * Get the count of sessions.
+		 */
+		int getNumSessions() const;
+		/**
+		 * Get the count of workers.
+		 */
+		int getNumWorkers() const;
+		/**
+		 * Get the worker owning a session.
+		 * \return	Worker Index, -1 if the session doesn't exist
+		 */
+		int getWorkerOf(int session) const;
+
+		/**
+		 * Start the workers.
+		 * \param pinWorkers	Pin each worker to one CPU
+		 */
+		void start(bool pinWorkers = false);
+		/**
+		 * Stop the workers. Queued events stay queued until the next start.
+		 */
+		void stop();
+		/**
+		 * Check if the workers are running.
+		 */
+		bool isRunning() const;
+
+		/**
+		 * Push an inbound message of a session and wake its worker. Called by one producer thread per session.
+		 * \param session		Session ID
+		 * \param message		Message
+		 * \param timeStamp		Time Stamp in Seconds on the clock of getCurrentTime()
+		 * \return	False if the session doesn't exist, the message isn't a Mackie Control message or the queue is full
+		 */
+		bool push(int session, const MessageView& message, double timeStamp);
+		/**
+		 * Push an inbound message of a session stamped with the current time.
+		 */
+		bool push(int session, const MessageView& message);
+		/**
+		 * Push all events of a MIDI buffer of a session and wake its worker once.
+		 * \param session		Session ID
+		 * \param buffer		MIDI Buffer
+		 * \param timeStamp		Time Stamp of sample position 0
+		 * \param sampleRate	Sample Rate used to convert sample positions to time
+		 * \return	Count of pushed events
+		 */
+		int push(int session, const juce::MidiBuffer& buffer, double timeStamp, double sampleRate);
+
+		/**
+		 * Get the clock of time stamps and latency.
+		 * \return	Current Time in Seconds
+		 */
+		static double getCurrentTime();
+
+		/**
+		 * Get the latency from push to handling of a session.
+		 * \return	Count of handled events, mean latency in seconds, max latency in seconds
+		 */
+		std::tuple<uint64_t, double, double> getLatency(int session) const;
+		/**
+		 * Reset the latency of all sessions. Called while the host is stopped.
+		 */
+		void resetLatency();
+		/**
+		 * Get the count of events handled by all sessions.
+		 */
+		uint64_t getNumHandled() const;
+		/**
+		 * Get the count of events dropped by all sessions.
+		 */
+		uint64_t getNumDropped() const;
+
+	private:
+		struct Session;
+		class Worker;
+
+		std::vector<std::unique_ptr<Session>> sessions;
+		std::vector<std::unique_ptr<Worker>> workers;
+		double tickInterval = 0;
+		bool running = false;
+
+		void wake(Session& session);
+
+		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SessionHost)
+	};
+}
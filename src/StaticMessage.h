@@ -0,0 +1,100 @@
+﻿/*****************************************************************//**
+ * \file	StaticMessage.h
+ * \brief	Compile-time byte images of fixed Mackie Control messages.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ *********************************************************************/
+
+#pragma once
+
+#include "MackieControl.h"
+
+namespace mackieControl {
+	/**
+	 * Create the raw MIDI bytes of a Mackie Control message via MIDI note message at compile time.
+	 * make<NoteMessage::PLAY, VelocityMessage::On>()
+	 */
+	template <NoteMessage type, VelocityMessage vel>
+	constexpr std::array<uint8_t, 3> make() {
+		static_assert(isValidNoteMessage(type), "Invalid note message");
+		static_assert(isValidVelocityMessage(vel), "Invalid velocity message");
+
+		return { 0x90, static_cast<uint8_t>(type), static_cast<uint8_t>(vel) };
+	}
+	/**
+	 * Create the raw MIDI bytes of a Mackie Control message via MIDI controller message at compile time.
+	 * make<CCMessage::VPotLEDRing1, 0x21>()
+	 */
+	template <CCMessage type, int value>
+	constexpr std::array<uint8_t, 3> make() {
+		static_assert(isValidCCMessage(type), "Invalid CC message");
+		static_assert(value >= 0 && value < 128, "CC value out of range");
+
+		return { 0xB0, static_cast<uint8_t>(type), static_cast<uint8_t>(value) };
+	}
+	/**
+	 * Create the raw MIDI bytes of a Mackie Control message via MIDI system exclusive message at compile time.
+	 * make<SysExMessage::AllLEDsOff>(), make<SysExMessage::GlobalLCDMeterMode, 1>()
+	 */
+	template <SysExMessage type, uint8_t... data>
+	constexpr std::array<uint8_t, 1 + 5 + sizeof...(data) + 1> make() {
+		static_assert(isValidSysExMessage(type), "Invalid system exclusive message");
+		static_assert(((data < 0x80) && ...), "System exclusive data out of range");
+
+		std::array<uint8_t, 1 + 5 + sizeof...(data) + 1> result{ 0xF0, 0, 0, 0, 0, static_cast<uint8_t>(type), data..., 0xF7 };
+		return result;
+	}
+	/**
+	 * Create the raw MIDI bytes of a Mackie Control message via MIDI pitch wheel message at compile time.
+	 * \param channel		Channel Number
+	 * \param value			Fader Value
+	 */
+	template <int channel, int value>
+	constexpr std::array<uint8_t, 3> makePitchWheel() {
+		static_assert(channel >= 1 && channel <= 9, "Fader channel out of range");
+		static_assert(value >= 0 && value < 16384, "Fader value out of range");
+
+		return { static_cast<uint8_t>(0xE0 | (channel - 1)),
+			static_cast<uint8_t>(value & 0x7F), static_cast<uint8_t>((value >> 7) & 0x7F) };
+	}
+	/**
+	 * Create the raw MIDI bytes of a Mackie Control message via MIDI channel pressure message at compile time.
+	 * \param channel		Meter Channel Number
+	 * \param value			Meter Value
+	 */
+	template <int channel, int value>
+	constexpr std::array<uint8_t, 2> makeChannelPressure() {
+		static_assert(channel >= 1 && channel <= 8, "Meter channel out of range");
+		static_assert(value >= 0 && value < 16, "Meter value out of range");
+
+		return { 0xD0, static_cast<uint8_t>((channel - 1) * 16 + value) };
+	}
+
+	/**
+	 * Join the raw MIDI bytes of several messages into one image at compile time.
+	 * join(make<SysExMessage::AllLEDsOff>(), make<NoteMessage::PLAY, VelocityMessage::On>())
+	 */
+	template <std::size_t... N>
+	constexpr std::array<uint8_t, (N + ...)> join(const std::array<uint8_t, N>&... images) {
+		std::array<uint8_t, (N + ...)> result{};
+		std::size_t size = 0;
+		((std::copy(images.begin(), images.end(), result.begin() + size), size += N), ...);
+		return result;
+	}
+
+	/**
+	 * Raw MIDI bytes of a fixed Mackie Control message as static data.
+	 * staticMessage<NoteMessage::PLAY, VelocityMessage::On>
+	 */
+	template <auto... args>
+	inline constexpr auto staticMessage = make<args...>();
+
+	static_assert(classifyMessage(make<NoteMessage::PLAY, VelocityMessage::On>().data(), 3) == MessageType::Note);
+	static_assert(classifyMessage(make<CCMessage::VPotLEDRing1, 0>().data(), 3) == MessageType::CC);
+	static_assert(classifyMessage(make<SysExMessage::AllLEDsOff>().data(), 7) == MessageType::SysEx);
+	static_assert(classifyMessage(makePitchWheel<9, 16383>().data(), 3) == MessageType::PitchWheel);
+	static_assert(classifyMessage(makeChannelPressure<8, 15>().data(), 2) == MessageType::ChannelPressure);
+}
@@ -0,0 +1,114 @@
+/*****************************************************************//**
+ * \file	StreamParser.cpp
+ * \brief	Streaming parser of raw MIDI bytes into Mackie Control messages.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ *********************************************************************/
+
+#include "StreamParser.h"
+
+#include <bit>
+
+namespace mackieControl {
+	StreamParser::StreamParser(int sysExCapacity) {
+		this->sysExBuffer.resize(std::max(sysExCapacity, 2));
+	}
+
+	int StreamParser::parse(std::span<const uint8_t> bytes, juce::MidiBuffer& buffer, int samplePosition) {
+		return this->parse(bytes, [&buffer, samplePosition](const MessageView& message) {
+			auto data = message.getRawData();
+			buffer.addEvent(data.data(), static_cast<int>(data.size()), samplePosition);
+			});
+	}
+
+	void StreamParser::reset() {
+		this->sysExSize = 0;
+		this->inSysEx = false;
+		this->sysExOverflowed = false;
+		this->shortSize = 0;
+		this->expectedSize = 0;
+		this->runningStatus = 0;
+	}
+
+	bool StreamParser::isInSysEx() const {
+		return this->inSysEx;
+	}
+
+	uint64_t StreamParser::getNumInvalid() const {
+		return this->numInvalid;
+	}
+
+	uint64_t StreamParser::getNumOverflows() const {
+		return this->numOverflows;
+	}
+
+	uint64_t StreamParser::getNumRealtime() const {
+		return this->numRealtime;
+	}
+
+	const uint8_t* StreamParser::findStatusByte(const uint8_t* begin, const uint8_t* end) {
+		const uint8_t* ptr = begin;
+		while (end - ptr >= 8) {
+			uint64_t word;
+			std::memcpy(&word, ptr, sizeof(word));
+
+			uint64_t mask = word & 0x8080808080808080ULL;
+			if (mask) {
+				if constexpr (std::endian::native == std::endian::little) {
+					return ptr + (std::countr_zero(mask) >> 3);
+				}
+				else {
+					return ptr + (std::countl_zero(mask) >> 3);
+				}
+			}
+			ptr += 8;
+		}
+
+		while (ptr < end && !(*ptr & 0x80)) {
+			ptr++;
+		}
+		return ptr;
+	}
+
+	void StreamParser::beginStatus(uint8_t status) {
+		if (status == 0xF0) {
+			this->inSysEx = true;
+			this->sysExOverflowed = false;
+			this->sysExSize = 0;
+			this->runningStatus = 0;
+			this->appendSysEx(&status, 1);
+			return;
+		}
+
+		if (status < 0xF0) {
+			// Channel message, which sets the running status
+			this->runningStatus = status;
+			this->shortBytes[0] = status;
+			this->shortSize = 1;
+			this->expectedSize = ((status & 0xE0) == 0xC0) ? 2 : 3;
+			return;
+		}
+
+		// System common messages cancel the running status
+		this->runningStatus = 0;
+		this->shortSize = 0;
+	}
+
+	bool StreamParser::appendSysEx(const uint8_t* data, int size) {
+		if (this->sysExOverflowed) { return false; }
+		if (size <= 0) { return true; }
+
+		if (this->sysExSize + size > static_cast<int>(this->sysExBuffer.size())) {
+			this->sysExOverflowed = true;
+			this->numOverflows++;
+			return false;
+		}
+
+		std::memcpy(&(this->sysExBuffer[this->sysExSize]), data, size);
+		this->sysExSize += size;
+		return true;
+	}
+}
@@ -0,0 +1,160 @@
+﻿/*****************************************************************//**
+ * \file	StreamParser.h
+ * \brief	Streaming parser of raw MIDI bytes into Mackie Control messages.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ *********************************************************************/
+
+#pragma once
+
+#include "MessageView.h"
+
+namespace mackieControl {
+	/**
+	 * Streaming parser of raw MIDI bytes from serial or USB bulk transports.
+	 * Bytes can arrive in arbitrary chunks. The parser handles running status, realtime bytes inside
+	 * MIDI system exclusive messages and reassembles MIDI system exclusive messages split across chunks
+	 * in a fixed-capacity buffer allocated on construction.
+	 */
+	class MACKIE_API StreamParser final {
+	public:
+		/**
+		 * Create a stream parser.
+		 * \param sysExCapacity		Max raw size of a reassembled MIDI system exclusive message
+		 */
+		explicit StreamParser(int sysExCapacity = Message::getLCDSize(112));
+
+		/**
+		 * Parse a chunk of raw MIDI bytes and pass each completed Mackie Control message to the handler.
+		 * The message view is valid until the handler returns.
+		 * \param bytes			Raw MIDI Bytes
+		 * \param handler		void(const MessageView&)
+		 * \return	Count of completed Mackie Control messages
+		 */
+		template <typename Handler>
+		int parse(std::span<const uint8_t> bytes, Handler&& handler) {
+			int count = 0;
+			const uint8_t* ptr = bytes.data();
+			const uint8_t* end = ptr + bytes.size();
+
+			while (ptr < end) {
+				if (this->inSysEx) {
+					// Copy the data bytes of MIDI system exclusive message up to the next status byte at once
+					const uint8_t* next = StreamParser::findStatusByte(ptr, end);
+					this->appendSysEx(ptr, static_cast<int>(next - ptr));
+					ptr = next;
+					if (ptr == end) { break; }
+				}
+
+				uint8_t byte = *ptr++;
+				if (byte >= 0xF8) {
+					// Realtime bytes can appear anywhere and don't change the parser state
+					this->numRealtime++;
+					continue;
+				}
+
+				if (byte & 0x80) {
+					if (this->inSysEx) {
+						this->inSysEx = false;
+						if (byte == 0xF7) {
+							if (this->appendSysEx(&byte, 1)
+								&& this->emit(MessageView{ this->sysExBuffer.data(), this->sysExSize }, handler)) {
+								count++;
+							}
+							continue;
+						}
+
+						// MIDI system exclusive message aborted by another status byte
+						this->numInvalid++;
+					}
+
+					this->beginStatus(byte);
+					continue;
+				}
+
+				if (this->runningStatus == 0) { continue; }
+
+				this->shortBytes[this->shortSize++] = byte;
+				if (this->shortSize == this->expectedSize) {
+					if (this->emit(MessageView{ this->shortBytes.data(), this->shortSize }, handler)) {
+						count++;
+					}
+					this->shortSize = 1;
+				}
+			}
+
+			return count;
+		}
+		/**
+		 * Parse a chunk of raw MIDI bytes and add each completed Mackie Control message to the MIDI buffer.
+		 * \param bytes				Raw MIDI Bytes
+		 * \param buffer			MIDI Buffer
+		 * \param samplePosition	Sample Position of added events
+		 * \return	Count of completed Mackie Control messages
+		 */
+		int parse(std::span<const uint8_t> bytes, juce::MidiBuffer& buffer, int samplePosition = 0);
+
+		/**
+		 * Drop the partial message and the running status.
+		 */
+		void reset();
+		/**
+		 * Check if a MIDI system exclusive message is being reassembled.
+		 */
+		bool isInSysEx() const;
+
+		/**
+		 * Get the count of completed messages which weren't Mackie Control messages,
+		 * including aborted MIDI system exclusive messages.
+		 */
+		uint64_t getNumInvalid() const;
+		/**
+		 * Get the count of MIDI system exclusive messages dropped because they were larger than the capacity.
+		 */
+		uint64_t getNumOverflows() const;
+		/**
+		 * Get the count of skipped realtime bytes.
+		 */
+		uint64_t getNumRealtime() const;
+
+		/**
+		 * Find the first status byte in the range, testing 8 bytes at a time.
+		 * \return	Pointer to the status byte, or end if not found
+		 */
+		static const uint8_t* findStatusByte(const uint8_t* begin, const uint8_t* end);
+
+	private:
+		std::vector<uint8_t> sysExBuffer;
+		int sysExSize = 0;
+		bool inSysEx = false;
+		bool sysExOverflowed = false;
+
+		std::array<uint8_t, 3> shortBytes{};
+		int shortSize = 0;
+		int expectedSize = 0;
+		uint8_t runningStatus = 0;
+
+		uint64_t numInvalid = 0;
+		uint64_t numOverflows = 0;
+		uint64_t numRealtime = 0;
+
+		void beginStatus(uint8_t status);
+		bool appendSysEx(const uint8_t* data, int size);
+
+		template <typename Handler>
+		bool emit(const MessageView& message, Handler& handler) {
+			if (message.getType() == MessageType::Invalid) {
+				this->numInvalid++;
+				return false;
+			}
+
+			handler(message);
+			return true;
+		}
+
+		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(StreamParser)
+	};
+}
@@ -0,0 +1,173 @@
+/*****************************************************************//**
+ * \file	SurfaceState.cpp
+ * \brief	Shadow state of a Mackie Control surface with delta-only flush.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ *********************************************************************/
+
+#include "SurfaceState.h"
+
+namespace mackieControl {
+	/** Last-sent value of an element which state on the surface is unknown. */
+	constexpr uint8_t unknownByte = 0xFF;
+	/** Last-sent value of a fader which state on the surface is unknown. */
+	constexpr int unknownFader = -1;
+
+	/**
+	 * Check if the CC is sent from host to surface.
+	 */
+	static bool isOutputCC(int type) {
+		return (type >= static_cast<int>(CCMessage::VPotLEDRing1) && type <= static_cast<int>(CCMessage::VPotLEDRing8))
+			|| (type >= static_cast<int>(CCMessage::TimeCodeBBTDisplay1) && type <= static_cast<int>(CCMessage::Assignment7SegmentDisplay3));
+	}
+
+	SurfaceState::SurfaceState() {
+		this->notes.fill(static_cast<uint8_t>(VelocityMessage::Off));
+		this->ccs.fill(0);
+		this->faders.fill(0);
+
+		this->invalidate();
+	}
+
+	void SurfaceState::setNote(NoteMessage type, VelocityMessage vel) {
+		if (!isValidNoteMessage(type) || !isValidVelocityMessage(vel)) { return; }
+
+		int index = static_cast<int>(type);
+		this->notes[index] = static_cast<uint8_t>(vel);
+		this->dirtyNotes[index] = (this->notes[index] != this->sentNotes[index]);
+	}
+
+	void SurfaceState::setCC(CCMessage type, int value) {
+		if (!isValidCCMessage(type) || !isOutputCC(static_cast<int>(type))) { return; }
+
+		int index = static_cast<int>(type);
+		this->ccs[index] = static_cast<uint8_t>(value & 0x7F);
+		this->dirtyCCs[index] = (this->ccs[index] != this->sentCCs[index]);
+	}
+
+	void SurfaceState::setPitchWheel(int channel, int value) {
+		if (channel < 1 || channel > numFaders) { return; }
+
+		int index = channel - 1;
+		this->faders[index] = juce::jlimit(0, 16383, value);
+		this->dirtyFaders[index] = (this->faders[index] != this->sentFaders[index]);
+	}
+
+	void SurfaceState::setLCD(uint8_t place, const char* data, int size) {
+		this->lcd.setText(place, data, size);
+	}
+
+	VelocityMessage SurfaceState::getNote(NoteMessage type) const {
+		if (!isValidNoteMessage(type)) { return VelocityMessage::Off; }
+		return static_cast<VelocityMessage>(this->notes[static_cast<int>(type)]);
+	}
+
+	int SurfaceState::getCC(CCMessage type) const {
+		if (!isValidCCMessage(type)) { return 0; }
+		return this->ccs[static_cast<int>(type)];
+	}
+
+	int SurfaceState::getPitchWheel(int channel) const {
+		if (channel < 1 || channel > numFaders) { return 0; }
+		return this->faders[channel - 1];
+	}
+
+	std::tuple<const char*, int> SurfaceState::getLCD() const {
+		return this->lcd.getText();
+	}
+
+	LCDFrameBuffer& SurfaceState::getLCDFrameBuffer() {
+		return this->lcd;
+	}
+
+	bool SurfaceState::isDirty() const {
+		return this->dirtyNotes.any() || this->dirtyCCs.any()
+			|| this->dirtyFaders.any() || this->lcd.isDirty();
+	}
+
+	void SurfaceState::invalidate() {
+		this->sentNotes.fill(unknownByte);
+		this->sentCCs.fill(unknownByte);
+		this->sentFaders.fill(unknownFader);
+
+		this->dirtyNotes.reset();
+		for (auto i : validNoteMessage) {
+			this->dirtyNotes.set(static_cast<int>(i));
+		}
+		this->dirtyCCs.reset();
+		for (auto i : validCCMessage) {
+			if (isOutputCC(static_cast<int>(i))) {
+				this->dirtyCCs.set(static_cast<int>(i));
+			}
+		}
+		this->dirtyFaders.set();
+		this->lcd.invalidate();
+	}
+
+	int SurfaceState::flush(juce::MidiBuffer& buffer, int samplePosition) {
+		return this->flushTo([&buffer, samplePosition](const uint8_t* data, int size) {
+			return buffer.addEvent(data, size, samplePosition);
+			});
+	}
+
+	int SurfaceState::flush(std::span<uint8_t> dest) {
+		int used = 0;
+		this->flushTo([dest, &used](const uint8_t* data, int size) {
+			if (used + size > static_cast<int>(dest.size())) { return false; }
+			std::memcpy(&dest[used], data, size);
+			used += size;
+			return true;
+			});
+		return used;
+	}
+
+	template <typename Writer>
+	int SurfaceState::flushTo(Writer&& writer) {
+		int total = 0;
+		auto emit = [&writer, &total](const uint8_t* data, int size) {
+			if (!writer(data, size)) { return false; }
+			total += size;
+			return true;
+		};
+
+		// Faders first, they are the most latency-sensitive feedback
+		for (int i = 0; i < numFaders; i++) {
+			if (!this->dirtyFaders[i]) { continue; }
+			if (this->faders[i] != this->sentFaders[i]) {
+				uint8_t bytes[3] = { static_cast<uint8_t>(0xE0 | i),
+					static_cast<uint8_t>(this->faders[i] & 0x7F), static_cast<uint8_t>((this->faders[i] >> 7) & 0x7F) };
+				if (!emit(bytes, sizeof(bytes))) { return total; }
+				this->sentFaders[i] = this->faders[i];
+			}
+			this->dirtyFaders[i] = false;
+		}
+
+		for (int i = 0; i < 128; i++) {
+			if (!this->dirtyNotes[i]) { continue; }
+			if (this->notes[i] != this->sentNotes[i]) {
+				uint8_t bytes[3] = { 0x90, static_cast<uint8_t>(i), this->notes[i] };
+				if (!emit(bytes, sizeof(bytes))) { return total; }
+				this->sentNotes[i] = this->notes[i];
+			}
+			this->dirtyNotes[i] = false;
+		}
+
+		for (int i = 0; i < 128; i++) {
+			if (!this->dirtyCCs[i]) { continue; }
+			if (this->ccs[i] != this->sentCCs[i]) {
+				uint8_t bytes[3] = { 0xB0, static_cast<uint8_t>(i), this->ccs[i] };
+				if (!emit(bytes, sizeof(bytes))) { return total; }
+				this->sentCCs[i] = this->ccs[i];
+			}
+			this->dirtyCCs[i] = false;
+		}
+
+		// The frame buffer keeps its own byte counters
+		total += this->lcd.flushTo(writer);
+
+		return total;
+	}
+}
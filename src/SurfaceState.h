@@ -0,0 +1,123 @@
+﻿/*****************************************************************//**
+ * \file	SurfaceState.h
+ * \brief	Shadow state of a Mackie Control surface with delta-only flush.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ *********************************************************************/
+
+#pragma once
+
+#include <bitset>
+
+#include "LCDFrameBuffer.h"
+
+namespace mackieControl {
+	/**
+	 * Shadow state of a Mackie Control surface.
+	 * Holds the wanted and the last-sent value of every LED note, CC, fader and LCD character,
+	 * and only emits the elements which changed since the last flush. LCD changes are sent by LCDFrameBuffer.
+	 */
+	class MACKIE_API SurfaceState final {
+	public:
+		/** Count of fader channels (1-8 and the master channel). */
+		static constexpr int numFaders = 9;
+		/** Count of characters of the LCD. */
+		static constexpr int lcdSize = LCDFrameBuffer::size;
+
+		/**
+		 * Create a surface state. Every element is unknown, so the first flush sends the whole surface.
+		 */
+		SurfaceState();
+
+		/**
+		 * Set the velocity of a Mackie Control note.
+		 * \param type			Message Type
+		 * \param vel			Message On/Off Type
+		 */
+		void setNote(NoteMessage type, VelocityMessage vel);
+		/**
+		 * Set the value of a Mackie Control CC.
+		 * CCs sent from surface to host (V-Pots, jog wheel and external controller) are ignored.
+		 * \param type			Message Type
+		 * \param value			Value
+		 */
+		void setCC(CCMessage type, int value);
+		/**
+		 * Set the fader value.
+		 * \param channel		Channel Number (1-9)
+		 * \param value			Fader Value
+		 */
+		void setPitchWheel(int channel, int value);
+		/**
+		 * Set the LCD characters.
+		 * \param place			Line Place
+		 * \param data			Data Pointer
+		 * \param size			Data Size
+		 */
+		void setLCD(uint8_t place, const char* data, int size);
+
+		/**
+		 * Get the velocity of a Mackie Control note.
+		 */
+		VelocityMessage getNote(NoteMessage type) const;
+		/**
+		 * Get the value of a Mackie Control CC.
+		 */
+		int getCC(CCMessage type) const;
+		/**
+		 * Get the fader value.
+		 * \param channel		Channel Number (1-9)
+		 */
+		int getPitchWheel(int channel) const;
+		/**
+		 * Get the LCD characters.
+		 * \return	Data Pointer, Data Size
+		 */
+		std::tuple<const char*, int> getLCD() const;
+		/**
+		 * Get the LCD frame buffer, e.g. to tune its cost model.
+		 */
+		LCDFrameBuffer& getLCDFrameBuffer();
+
+		/**
+		 * Check if any element changed since the last flush.
+		 */
+		bool isDirty() const;
+		/**
+		 * Forget the last-sent values, so the next flush sends the whole surface.
+		 */
+		void invalidate();
+
+		/**
+		 * Append the changed elements to the MIDI buffer and mark them as sent.
+		 * \param buffer		MIDI Buffer
+		 * \param samplePosition	Sample Position
+		 * \return	Count of bytes emitted
+		 */
+		int flush(juce::MidiBuffer& buffer, int samplePosition = 0);
+		/**
+		 * Write the changed elements into the buffer as raw MIDI bytes and mark them as sent.
+		 * Elements which don't fit into the buffer stay dirty for the next flush.
+		 * \param dest			Destination Buffer
+		 * \return	Count of bytes written
+		 */
+		int flush(std::span<uint8_t> dest);
+
+	private:
+		std::array<uint8_t, 128> notes, sentNotes;
+		std::array<uint8_t, 128> ccs, sentCCs;
+		std::array<int, numFaders> faders, sentFaders;
+		LCDFrameBuffer lcd;
+
+		std::bitset<128> dirtyNotes, dirtyCCs;
+		std::bitset<numFaders> dirtyFaders;
+
+		template <typename Writer>
+		int flushTo(Writer&& writer);
+
+		JUCE_LEAK_DETECTOR(SurfaceState)
+	};
+}
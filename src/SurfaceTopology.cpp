@@ -0,0 +1,222 @@
+/*****************************************************************//**
+ * \file	SurfaceTopology.cpp
+ * \brief	Global strip addressing of a main unit with extenders on separate ports.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ *********************************************************************/
+
+#include "SurfaceTopology.h"
+
+namespace mackieControl {
+	/** Count of characters of each strip on an LCD line. */
+	constexpr int lcdCellSize = 7;
+	/** Count of characters of an LCD line. */
+	constexpr int lcdLineSize = 56;
+	/** Max raw size of a strip message. */
+	constexpr int maxStripMessageSize = 32;
+
+	SurfaceTopology::SurfaceTopology(int numPorts, int reserveBytes) {
+		numPorts = std::max(numPorts, 1);
+		this->outputs.resize(numPorts);
+		for (auto& buffer : this->outputs) {
+			buffer.ensureSize(std::max(reserveBytes, 0));
+		}
+
+		this->portOfPosition.resize(numPorts);
+		this->positionOfPort.resize(numPorts);
+		for (int i = 0; i < numPorts; i++) {
+			this->portOfPosition[i] = i;
+			this->positionOfPort[i] = i;
+		}
+	}
+
+	bool SurfaceTopology::setPortOrder(std::span<const int> ports) {
+		int numPorts = this->getNumPorts();
+		if (static_cast<int>(ports.size()) != numPorts) { return false; }
+
+		std::vector<int> positions(numPorts, -1);
+		for (int i = 0; i < numPorts; i++) {
+			int port = ports[i];
+			if (port < 0 || port >= numPorts || positions[port] >= 0) { return false; }
+			positions[port] = i;
+		}
+
+		this->portOfPosition.assign(ports.begin(), ports.end());
+		this->positionOfPort = std::move(positions);
+		return true;
+	}
+
+	int SurfaceTopology::getNumPorts() const {
+		return static_cast<int>(this->outputs.size());
+	}
+
+	int SurfaceTopology::getNumStrips() const {
+		return this->getNumPorts() * stripsPerUnit;
+	}
+
+	std::tuple<int, int> SurfaceTopology::toLocal(int strip) const {
+		if (strip < 1 || strip > this->getNumStrips()) { return { -1, 0 }; }
+		return { this->portOfPosition[(strip - 1) / stripsPerUnit], (strip - 1) % stripsPerUnit + 1 };
+	}
+
+	int SurfaceTopology::toGlobal(int port, int channel) const {
+		if (port < 0 || port >= this->getNumPorts()) { return 0; }
+		if (channel < 1 || channel > stripsPerUnit) { return 0; }
+		return this->positionOfPort[port] * stripsPerUnit + channel;
+	}
+
+	std::tuple<int, int> SurfaceTopology::routeInput(int port, const MessageView& message) const {
+		int channel = SurfaceTopology::getLocalChannel(message);
+		int strip = this->toGlobal(port, channel);
+		return { strip, (strip > 0) ? channel : 0 };
+	}
+
+	int SurfaceTopology::getLocalChannel(const MessageView& message) {
+		auto bytes = message.getRawData();
+		switch (message.getType()) {
+		case MessageType::Note: {
+			int note = bytes[1];
+			if (note <= static_cast<int>(NoteMessage::VSelectCh8)) { return note % stripsPerUnit + 1; }
+			if (note >= static_cast<int>(NoteMessage::FaderTouchCh1) && note <= static_cast<int>(NoteMessage::FaderTouchCh8)) {
+				return note - static_cast<int>(NoteMessage::FaderTouchCh1) + 1;
+			}
+			return 0;
+		}
+		case MessageType::CC: {
+			int cc = bytes[1];
+			if (cc >= static_cast<int>(CCMessage::VPot1) && cc <= static_cast<int>(CCMessage::VPot8)) {
+				return cc - static_cast<int>(CCMessage::VPot1) + 1;
+			}
+			if (cc >= static_cast<int>(CCMessage::VPotLEDRing1) && cc <= static_cast<int>(CCMessage::VPotLEDRing8)) {
+				return cc - static_cast<int>(CCMessage::VPotLEDRing1) + 1;
+			}
+			return 0;
+		}
+		case MessageType::PitchWheel: {
+			// Channel 9 is the master fader
+			int channel = (bytes[0] & 0x0F) + 1;
+			return (channel <= stripsPerUnit) ? channel : 0;
+		}
+		case MessageType::ChannelPressure:
+			return (bytes[1] >> 4) + 1;
+		case MessageType::SysEx: {
+			if (bytes.size() < 1 + 5 + 1 + 1) { return 0; }
+
+			auto type = static_cast<SysExMessage>(bytes[1 + 4]);
+			if (type == SysExMessage::FaderTouchSensitivity || type == SysExMessage::ChannelMeterMode) {
+				return (bytes[1 + 5] < stripsPerUnit) ? (bytes[1 + 5] + 1) : 0;
+			}
+			if (type == SysExMessage::LCD) {
+				// Only LCD messages inside the cell of one strip belong to the strip
+				int place = bytes[1 + 5] % lcdLineSize;
+				int size = static_cast<int>(bytes.size()) - Message::getLCDSize(0);
+				if (place % lcdCellSize + size > lcdCellSize) { return 0; }
+				return place / lcdCellSize + 1;
+			}
+			return 0;
+		}
+		default:
+			return 0;
+		}
+	}
+
+	bool SurfaceTopology::setLocalChannel(std::span<uint8_t> bytes, int channel) {
+		if (channel < 1 || channel > stripsPerUnit) { return false; }
+
+		MessageView message{ bytes.data(), static_cast<int>(bytes.size()) };
+		if (SurfaceTopology::getLocalChannel(message) == 0) { return false; }
+
+		int index = channel - 1;
+		switch (message.getType()) {
+		case MessageType::Note:
+			if (bytes[1] <= static_cast<int>(NoteMessage::VSelectCh8)) {
+				bytes[1] = static_cast<uint8_t>(bytes[1] / stripsPerUnit * stripsPerUnit + index);
+			}
+			else {
+				bytes[1] = static_cast<uint8_t>(static_cast<int>(NoteMessage::FaderTouchCh1) + index);
+			}
+			return true;
+		case MessageType::CC:
+			if (bytes[1] <= static_cast<int>(CCMessage::VPot8)) {
+				bytes[1] = static_cast<uint8_t>(static_cast<int>(CCMessage::VPot1) + index);
+			}
+			else {
+				bytes[1] = static_cast<uint8_t>(static_cast<int>(CCMessage::VPotLEDRing1) + index);
+			}
+			return true;
+		case MessageType::PitchWheel:
+			bytes[0] = static_cast<uint8_t>(0xE0 | index);
+			return true;
+		case MessageType::ChannelPressure:
+			bytes[1] = static_cast<uint8_t>((index << 4) | (bytes[1] & 0x0F));
+			return true;
+		case MessageType::SysEx:
+			if (static_cast<SysExMessage>(bytes[1 + 4]) == SysExMessage::LCD) {
+				int place = bytes[1 + 5];
+				bytes[1 + 5] = static_cast<uint8_t>(place / lcdLineSize * lcdLineSize + index * lcdCellSize + place % lcdLineSize % lcdCellSize);
+			}
+			else {
+				bytes[1 + 5] = static_cast<uint8_t>(index);
+			}
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	bool SurfaceTopology::addToStrip(int strip, const MessageView& message, int samplePosition) {
+		auto [port, channel] = this->toLocal(strip);
+		if (port < 0) { return false; }
+
+		auto data = message.getRawData();
+		if (data.size() > maxStripMessageSize) { return false; }
+
+		std::array<uint8_t, maxStripMessageSize> bytes;
+		std::copy(data.begin(), data.end(), bytes.begin());
+		std::span<uint8_t> local{ bytes.data(), data.size() };
+		if (!SurfaceTopology::setLocalChannel(local, channel)) { return false; }
+
+		return this->outputs[port].addEvent(local.data(), static_cast<int>(local.size()), samplePosition);
+	}
+
+	bool SurfaceTopology::addToPort(int port, const MessageView& message, int samplePosition) {
+		if (port < 0 || port >= this->getNumPorts()) { return false; }
+
+		auto data = message.getRawData();
+		return this->outputs[port].addEvent(data.data(), static_cast<int>(data.size()), samplePosition);
+	}
+
+	void SurfaceTopology::addToAll(const MessageView& message, int samplePosition) {
+		auto data = message.getRawData();
+		for (auto& buffer : this->outputs) {
+			buffer.addEvent(data.data(), static_cast<int>(data.size()), samplePosition);
+		}
+	}
+
+	juce::MidiBuffer& SurfaceTopology::getPortBuffer(int port) {
+		return this->outputs[juce::jlimit(0, this->getNumPorts() - 1, port)];
+	}
+
+	int SurfaceTopology::flush(int port, std::span<uint8_t> dest) {
+		if (port < 0 || port >= this->getNumPorts()) { return 0; }
+
+		auto& buffer = this->outputs[port];
+		int size = 0;
+		for (const auto metadata : buffer) {
+			size += metadata.numBytes;
+		}
+		if (size == 0 || size > static_cast<int>(dest.size())) { return 0; }
+
+		int used = 0;
+		for (const auto metadata : buffer) {
+			std::memcpy(&dest[used], metadata.data, metadata.numBytes);
+			used += metadata.numBytes;
+		}
+
+		buffer.clear();
+		return used;
+	}
+}
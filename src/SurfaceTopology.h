@@ -0,0 +1,138 @@
+﻿/*****************************************************************//**
+ * \file	SurfaceTopology.h
+ * \brief	Global strip addressing of a main unit with extenders on separate ports.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ *********************************************************************/
+
+#pragma once
+
+#include "MessageView.h"
+
+namespace mackieControl {
+	/**
+	 * Topology of several Mackie Control units (e.g. a main unit and extenders), each on its own MIDI port.
+	 * Maps global strip numbers (1 to 8 * count of ports) onto (port, local channel) and back,
+	 * and batches the outbound messages of each port into one MIDI buffer per flush.
+	 * Ports are indices from 0. Strips are numbered from left to right in port order.
+	 */
+	class MACKIE_API SurfaceTopology final {
+	public:
+		/** Count of strips of each unit. */
+		static constexpr int stripsPerUnit = 8;
+
+		/**
+		 * Create a topology.
+		 * \param numPorts		Count of units
+		 * \param reserveBytes	Bytes reserved in the MIDI buffer of each port
+		 */
+		explicit SurfaceTopology(int numPorts = 1, int reserveBytes = 2048);
+
+		/**
+		 * Set the order of the units from left to right.
+		 * \param ports			Port of each unit position, a permutation of all ports
+		 * \return	False if the order isn't a permutation of all ports
+		 */
+		bool setPortOrder(std::span<const int> ports);
+		/**
+		 * Get the count of ports.
+		 */
+		int getNumPorts() const;
+		/**
+		 * Get the count of strips.
+		 */
+		int getNumStrips() const;
+
+		/**
+		 * Map a global strip onto its unit.
+		 * \param strip			Global Strip Number
+		 * \return	Port, Local Channel Number (1-8), -1 and 0 if the strip doesn't exist
+		 */
+		std::tuple<int, int> toLocal(int strip) const;
+		/**
+		 * Map a channel of a unit onto the global strip.
+		 * \param port			Port
+		 * \param channel		Local Channel Number (1-8)
+		 * \return	Global Strip Number, 0 if the channel doesn't exist
+		 */
+		int toGlobal(int port, int channel) const;
+		/**
+		 * Route an inbound message of a port to the global strip it belongs to.
+		 * \param port			Port
+		 * \param message		Message
+		 * \return	Global Strip Number, Local Channel Number, 0 and 0 if the message doesn't belong to a strip
+		 */
+		std::tuple<int, int> routeInput(int port, const MessageView& message) const;
+
+		/**
+		 * Get the local channel a message belongs to.
+		 * \return	Local Channel Number (1-8), 0 if the message doesn't belong to a strip
+		 */
+		static int getLocalChannel(const MessageView& message);
+		/**
+		 * Move a strip message in place to another local channel.
+		 * \param bytes			Raw MIDI Bytes
+		 * \param channel		Local Channel Number (1-8)
+		 * \return	False if the message doesn't belong to a strip
+		 */
+		static bool setLocalChannel(std::span<uint8_t> bytes, int channel);
+
+		/**
+		 * Queue a strip message on the port of a global strip. The message may address any channel,
+		 * it is moved to the local channel of the strip.
+		 * \param strip			Global Strip Number
+		 * \param message		Message
+		 * \param samplePosition	Sample Position
+		 * \return	False if the strip doesn't exist or the message doesn't belong to a strip
+		 */
+		bool addToStrip(int strip, const MessageView& message, int samplePosition = 0);
+		/**
+		 * Queue a message on a port.
+		 * \return	False if the port doesn't exist
+		 */
+		bool addToPort(int port, const MessageView& message, int samplePosition = 0);
+		/**
+		 * Queue a message on every port.
+		 */
+		void addToAll(const MessageView& message, int samplePosition = 0);
+		/**
+		 * Get the queued messages of a port.
+		 */
+		juce::MidiBuffer& getPortBuffer(int port);
+
+		/**
+		 * Pass the queued messages of each port with messages to the handler as one block, then clear them.
+		 * \param handler		void(int port, const juce::MidiBuffer& buffer)
+		 * \return	Count of flushed ports
+		 */
+		template <typename Handler>
+		int flush(Handler&& handler) {
+			int count = 0;
+			for (int i = 0; i < this->getNumPorts(); i++) {
+				auto& buffer = this->outputs[i];
+				if (buffer.isEmpty()) { continue; }
+
+				handler(i, static_cast<const juce::MidiBuffer&>(buffer));
+				buffer.clear();
+				count++;
+			}
+			return count;
+		}
+		/**
+		 * Write the queued messages of a port into the buffer as raw MIDI bytes, then clear them.
+		 * \param port			Port
+		 * \param dest			Destination Buffer
+		 * \return	Count of bytes written, 0 if the messages don't fit and stay queued
+		 */
+		int flush(int port, std::span<uint8_t> dest);
+
+	private:
+		std::vector<juce::MidiBuffer> outputs;
+		std::vector<int> portOfPosition, positionOfPort;
+
+		JUCE_LEAK_DETECTOR(SurfaceTopology)
+	};
+}
@@ -0,0 +1,163 @@
+/*****************************************************************//**
+ * \file	TimeCodeDisplay.cpp
+ * \brief	Incremental time code/BBT display encoder.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ *********************************************************************/
+
+#include "TimeCodeDisplay.h"
+
+namespace mackieControl {
+	/** Ticks per quarter note of BBT positions. */
+	constexpr int ticksPerQuarterNote = 960;
+
+	/**
+	 * Write a number right-aligned into a field of characters. Digits which don't fit are cut off.
+	 * \param padZeros		Fill the field with zeros instead of spaces
+	 */
+	static void writeNumber(char* dest, int size, int64_t value, bool padZeros) {
+		value = std::max<int64_t>(value, 0);
+		for (int i = size - 1; i >= 0; i--) {
+			if (value == 0 && i < size - 1 && !padZeros) {
+				dest[i] = ' ';
+				continue;
+			}
+
+			dest[i] = static_cast<char>('0' + value % 10);
+			value /= 10;
+		}
+	}
+
+	TimeCodeDisplay::TimeCodeDisplay() {
+		this->digits.fill(' ');
+		this->invalidate();
+	}
+
+	void TimeCodeDisplay::setTimeCode(double seconds, double frameRate) {
+		seconds = std::max(seconds, 0.0);
+		int64_t wholeSeconds = static_cast<int64_t>(seconds);
+		int64_t frames = static_cast<int64_t>((seconds - wholeSeconds) * std::max(frameRate, 0.0));
+
+		std::array<char, numDigits> text;
+		writeNumber(&text[0], 3, wholeSeconds / 3600, false);
+		writeNumber(&text[3], 2, (wholeSeconds / 60) % 60, true);
+		writeNumber(&text[5], 2, wholeSeconds % 60, true);
+		writeNumber(&text[7], 3, frames, true);
+		this->setText(text);
+	}
+
+	void TimeCodeDisplay::setBBT(double ppqPosition, int numerator, int denominator) {
+		numerator = std::max(numerator, 1);
+		denominator = std::max(denominator, 1);
+
+		// Beat length and sixteenth length in ticks
+		int64_t beatTicks = std::max<int64_t>(ticksPerQuarterNote * 4 / denominator, 1);
+		int64_t divisionTicks = std::max<int64_t>(std::min<int64_t>(ticksPerQuarterNote / 4, beatTicks), 1);
+
+		int64_t ticks = static_cast<int64_t>(std::max(ppqPosition, 0.0) * ticksPerQuarterNote);
+		int64_t beats = ticks / beatTicks;
+		int64_t beatOffset = ticks % beatTicks;
+
+		std::array<char, numDigits> text;
+		writeNumber(&text[0], 3, beats / numerator + 1, false);
+		writeNumber(&text[3], 2, beats % numerator + 1, true);
+		writeNumber(&text[5], 2, beatOffset / divisionTicks + 1, true);
+		writeNumber(&text[7], 3, beatOffset % divisionTicks, true);
+		this->setText(text);
+	}
+
+	void TimeCodeDisplay::setBBT(double seconds, double tempo, int numerator, int denominator) {
+		this->setBBT(seconds * tempo / 60, numerator, denominator);
+	}
+
+	void TimeCodeDisplay::setText(std::span<const char> text) {
+		this->digits.fill(' ');
+		toMackieReversed(text, this->digits);
+	}
+
+	const std::array<uint8_t, TimeCodeDisplay::numDigits>& TimeCodeDisplay::getDigits() const {
+		return this->digits;
+	}
+
+	bool TimeCodeDisplay::isDirty() const {
+		return this->digits != this->sentDigits;
+	}
+
+	void TimeCodeDisplay::invalidate() {
+		// Mackie Control characters never have the high bit, so every digit differs from the sentinel
+		this->sentDigits.fill(0xFF);
+	}
+
+	int TimeCodeDisplay::update(juce::MidiBuffer& buffer, int samplePosition) {
+		return this->updateTo([&buffer, samplePosition](const uint8_t* data, int size) {
+			return buffer.addEvent(data, size, samplePosition);
+			});
+	}
+
+	int TimeCodeDisplay::update(std::span<uint8_t> dest) {
+		int used = 0;
+		this->updateTo([dest, &used](const uint8_t* data, int size) {
+			if (used + size > static_cast<int>(dest.size())) { return false; }
+			std::memcpy(&dest[used], data, size);
+			used += size;
+			return true;
+			});
+		return used;
+	}
+
+	uint64_t TimeCodeDisplay::getNumBytesSent() const {
+		return this->numBytesSent;
+	}
+
+	uint64_t TimeCodeDisplay::getNumBytesSaved() const {
+		return this->numBytesSaved;
+	}
+
+	template <typename Writer>
+	int TimeCodeDisplay::updateTo(Writer&& writer) {
+		int numChanged = 0, lastChanged = -1;
+		for (int i = 0; i < numDigits; i++) {
+			if (this->digits[i] != this->sentDigits[i]) {
+				numChanged++;
+				lastChanged = i;
+			}
+		}
+		if (numChanged == 0) { return 0; }
+
+		// MIDI system exclusive message updates the digits from the rightmost one up to the last changed one
+		constexpr int fullSize = Message::getTimeCodeBBTDisplaySize(numDigits);
+		int sysExSize = Message::getTimeCodeBBTDisplaySize(lastChanged + 1);
+		int ccSize = numChanged * 3;
+
+		int total = 0;
+		if (sysExSize < ccSize) {
+			std::array<uint8_t, fullSize> bytes;
+			int size = Message::writeTimeCodeBBTDisplay(bytes, this->digits.data(), lastChanged + 1);
+			if (!writer(bytes.data(), size)) { return 0; }
+
+			std::copy(this->digits.begin(), this->digits.begin() + lastChanged + 1, this->sentDigits.begin());
+			total = size;
+		}
+		else {
+			for (int i = 0; i <= lastChanged; i++) {
+				if (this->digits[i] == this->sentDigits[i]) { continue; }
+
+				uint8_t bytes[3] = { 0xB0,
+					static_cast<uint8_t>(static_cast<int>(CCMessage::TimeCodeBBTDisplay1) + i), static_cast<uint8_t>(this->digits[i] & 0x7F) };
+				if (!writer(bytes, sizeof(bytes))) { break; }
+
+				this->sentDigits[i] = this->digits[i];
+				total += sizeof(bytes);
+			}
+		}
+
+		if (total == 0) { return 0; }
+
+		this->numBytesSent += total;
+		this->numBytesSaved += std::max(fullSize - total, 0);
+		return total;
+	}
+}
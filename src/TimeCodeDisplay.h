@@ -0,0 +1,106 @@
+﻿/*****************************************************************//**
+ * \file	TimeCodeDisplay.h
+ * \brief	Incremental time code/BBT display encoder.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ *********************************************************************/
+
+#pragma once
+
+#include "MackieChar.h"
+
+namespace mackieControl {
+	/**
+	 * Encoder of the 10-digit time code/BBT display.
+	 * Caches the digits last sent and only emits the changed digits, either as one CC per digit or as one
+	 * MIDI system exclusive message covering the rightmost digits up to the leftmost changed one,
+	 * whichever takes fewer bytes. Never allocates, so it can run at display refresh rate.
+	 */
+	class MACKIE_API TimeCodeDisplay final {
+	public:
+		/** Count of digits of the display. */
+		static constexpr int numDigits = 10;
+
+		/**
+		 * Create a time code display encoder. The display is unknown, so the first update sends all digits.
+		 */
+		TimeCodeDisplay();
+
+		/**
+		 * Show a SMPTE time code as HHH MM SS FFF.
+		 * \param seconds		Position in Seconds
+		 * \param frameRate		Frames per Second
+		 */
+		void setTimeCode(double seconds, double frameRate);
+		/**
+		 * Show a musical position as BBB BB SS TTT (bars, beats, sixteenths, ticks of 960 PPQ).
+		 * \param ppqPosition	Position in Quarter Notes
+		 * \param numerator		Time Signature Numerator
+		 * \param denominator	Time Signature Denominator
+		 */
+		void setBBT(double ppqPosition, int numerator, int denominator);
+		/**
+		 * Show a musical position of a time with a constant tempo.
+		 * \param seconds		Position in Seconds
+		 * \param tempo			Beats per Minute
+		 * \param numerator		Time Signature Numerator
+		 * \param denominator	Time Signature Denominator
+		 */
+		void setBBT(double seconds, double tempo, int numerator, int denominator);
+		/**
+		 * Show ASCII text, aligned to the right of the display.
+		 */
+		void setText(std::span<const char> text);
+
+		/**
+		 * Get the wanted digits as Mackie Control characters, from right to left.
+		 */
+		const std::array<uint8_t, numDigits>& getDigits() const;
+		/**
+		 * Check if any digit changed since the last update.
+		 */
+		bool isDirty() const;
+		/**
+		 * Forget the digits last sent, so the next update sends all digits.
+		 */
+		void invalidate();
+
+		/**
+		 * Append the changed digits to the MIDI buffer in the cheapest form and mark them as sent.
+		 * \param buffer		MIDI Buffer
+		 * \param samplePosition	Sample Position
+		 * \return	Count of bytes emitted
+		 */
+		int update(juce::MidiBuffer& buffer, int samplePosition = 0);
+		/**
+		 * Write the changed digits into the buffer as raw MIDI bytes in the cheapest form and mark them as sent.
+		 * Digits which don't fit into the buffer stay dirty for the next update.
+		 * \param dest			Destination Buffer
+		 * \return	Count of bytes written
+		 */
+		int update(std::span<uint8_t> dest);
+
+		/**
+		 * Get the count of bytes sent by this encoder.
+		 */
+		uint64_t getNumBytesSent() const;
+		/**
+		 * Get the count of bytes saved compared with sending the whole display on every update.
+		 */
+		uint64_t getNumBytesSaved() const;
+
+	private:
+		std::array<uint8_t, numDigits> digits, sentDigits;
+
+		uint64_t numBytesSent = 0;
+		uint64_t numBytesSaved = 0;
+
+		template <typename Writer>
+		int updateTo(Writer&& writer);
+
+		JUCE_LEAK_DETECTOR(TimeCodeDisplay)
+	};
+}
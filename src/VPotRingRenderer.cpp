@@ -0,0 +1,148 @@
+/*****************************************************************//**
+ * \file	VPotRingRenderer.cpp
+ * \brief	V-Pot LED ring renderer with per-mode lookup tables.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ *********************************************************************/
+
+#include "VPotRingRenderer.h"
+
+namespace mackieControl {
+	/** Count of V-Pot LED ring modes. */
+	constexpr int numModes = 4;
+	/** Sentinel of unknown sent rings. Ring values never have the high bit. */
+	constexpr uint8_t unknown = 0xFF;
+
+	/**
+	 * Create the lookup table of V-Pot LED ring values (without the center LED) of each mode.
+	 * Single dot and boost/cut use positions 1-11, wrap uses 0-11 and spread uses 0-6.
+	 */
+	constexpr std::array<std::array<uint8_t, VPotRingRenderer::tableSize>, numModes> makeRingTable() {
+		constexpr std::array<int, numModes> lowest = { 1, 1, 0, 0 };
+		constexpr std::array<int, numModes> highest = { 11, 11, 11, 6 };
+
+		std::array<std::array<uint8_t, VPotRingRenderer::tableSize>, numModes> result{};
+		for (int mode = 0; mode < numModes; mode++) {
+			int range = highest[mode] - lowest[mode];
+			for (int i = 0; i < VPotRingRenderer::tableSize; i++) {
+				int position = lowest[mode] + (i * range * 2 + (VPotRingRenderer::tableSize - 1)) / ((VPotRingRenderer::tableSize - 1) * 2);
+				result[mode][i] = static_cast<uint8_t>(mode * 16 + position);
+			}
+		}
+		return result;
+	}
+	/** Lookup table of V-Pot LED ring values of each mode. */
+	constexpr auto ringTable = makeRingTable();
+
+	static_assert(ringTable[static_cast<int>(VPotLEDRingMode::BoostCutMode)][VPotRingRenderer::tableSize / 2] == 16 + 6);
+
+	VPotRingRenderer::VPotRingRenderer() {
+		this->modes.fill(VPotLEDRingMode::SingleDotMode);
+		this->centerLEDs.fill(false);
+		this->values.fill(0.f);
+		for (int i = 0; i < numRings; i++) {
+			this->render(i);
+		}
+		this->invalidate();
+	}
+
+	void VPotRingRenderer::setMode(int channel, VPotLEDRingMode mode) {
+		if (channel < 1 || channel > numRings) { return; }
+		this->modes[channel - 1] = mode;
+		this->render(channel - 1);
+	}
+
+	void VPotRingRenderer::setCenterLED(int channel, bool centerLEDOn) {
+		if (channel < 1 || channel > numRings) { return; }
+		this->centerLEDs[channel - 1] = centerLEDOn;
+		this->render(channel - 1);
+	}
+
+	void VPotRingRenderer::setValue(int channel, float value) {
+		if (channel < 1 || channel > numRings) { return; }
+		this->values[channel - 1] = value;
+		this->render(channel - 1);
+	}
+
+	void VPotRingRenderer::setValues(std::span<const float> values) {
+		int size = static_cast<int>(std::min<size_t>(values.size(), numRings));
+		for (int i = 0; i < size; i++) {
+			this->values[i] = values[i];
+			this->render(i);
+		}
+	}
+
+	int VPotRingRenderer::getRingValue(int channel) const {
+		if (channel < 1 || channel > numRings) { return 0; }
+		return this->rings[channel - 1];
+	}
+
+	int VPotRingRenderer::toRingValue(bool centerLEDOn, VPotLEDRingMode mode, float value) {
+		// NaN falls to 0
+		float position = (value > 0.f) ? std::min(value, 1.f) : 0.f;
+		int index = static_cast<int>(position * (tableSize - 1) + 0.5f);
+		return static_cast<int>(centerLEDOn) * 64 + ringTable[static_cast<int>(mode) & (numModes - 1)][index];
+	}
+
+	bool VPotRingRenderer::isDirty() const {
+		return this->rings != this->sentRings;
+	}
+
+	void VPotRingRenderer::invalidate() {
+		this->sentRings.fill(unknown);
+	}
+
+	int VPotRingRenderer::update(juce::MidiBuffer& buffer, int samplePosition) {
+		return this->updateTo([&buffer, samplePosition](const uint8_t* data, int size) {
+			return buffer.addEvent(data, size, samplePosition);
+			});
+	}
+
+	int VPotRingRenderer::update(std::span<uint8_t> dest) {
+		int used = 0;
+		this->updateTo([dest, &used](const uint8_t* data, int size) {
+			if (used + size > static_cast<int>(dest.size())) { return false; }
+			std::memcpy(&dest[used], data, size);
+			used += size;
+			return true;
+			});
+		return used;
+	}
+
+	uint64_t VPotRingRenderer::getNumBytesSent() const {
+		return this->numBytesSent;
+	}
+
+	uint64_t VPotRingRenderer::getNumBytesSaved() const {
+		return this->numBytesSaved;
+	}
+
+	void VPotRingRenderer::render(int index) {
+		this->rings[index] = static_cast<uint8_t>(
+			VPotRingRenderer::toRingValue(this->centerLEDs[index], this->modes[index], this->values[index]));
+	}
+
+	template <typename Writer>
+	int VPotRingRenderer::updateTo(Writer&& writer) {
+		int total = 0;
+		for (int i = 0; i < numRings; i++) {
+			if (this->rings[i] == this->sentRings[i]) { continue; }
+
+			uint8_t bytes[3] = { 0xB0,
+				static_cast<uint8_t>(static_cast<int>(CCMessage::VPotLEDRing1) + i), this->rings[i] };
+			if (!writer(bytes, sizeof(bytes))) { break; }
+
+			this->sentRings[i] = this->rings[i];
+			total += sizeof(bytes);
+		}
+
+		if (total == 0) { return 0; }
+
+		this->numBytesSent += total;
+		this->numBytesSaved += numRings * 3 - total;
+		return total;
+	}
+}
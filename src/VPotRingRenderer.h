@@ -0,0 +1,119 @@
+﻿/*****************************************************************//**
+ * \file	VPotRingRenderer.h
+ * \brief	V-Pot LED ring renderer with per-mode lookup tables.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ *********************************************************************/
+
+#pragma once
+
+#include "MackieControl.h"
+
+namespace mackieControl {
+	/**
+	 * Renders normalized parameter values onto the eight V-Pot LED rings.
+	 * Values are quantized to LED patterns through a lookup table of each ring mode,
+	 * and only the rings whose pattern differs from the last-sent one are updated.
+	 * Single dot and boost/cut always light an LED (0.5 is the center), wrap and spread are off at 0.
+	 */
+	class MACKIE_API VPotRingRenderer final {
+	public:
+		/** Count of V-Pot LED rings. */
+		static constexpr int numRings = 8;
+		/** Count of entries in the lookup table of each ring mode. */
+		static constexpr int tableSize = 1024;
+
+		/**
+		 * Create a V-Pot LED ring renderer. All rings are in single dot mode at 0 and unknown to the surface.
+		 */
+		VPotRingRenderer();
+
+		/**
+		 * Set the LED ring mode of a ring.
+		 * \param channel		Channel Number (1-8)
+		 * \param mode			LED Ring Mode
+		 */
+		void setMode(int channel, VPotLEDRingMode mode);
+		/**
+		 * Set the center LED of a ring.
+		 * \param channel		Channel Number (1-8)
+		 * \param centerLEDOn	Center LED On/Off
+		 */
+		void setCenterLED(int channel, bool centerLEDOn);
+		/**
+		 * Set the parameter value shown on a ring.
+		 * \param channel		Channel Number (1-8)
+		 * \param value			Normalized Value (0-1)
+		 */
+		void setValue(int channel, float value);
+		/**
+		 * Set the parameter values shown on the rings from channel 1.
+		 * \param values		Normalized Values (0-1)
+		 */
+		void setValues(std::span<const float> values);
+
+		/**
+		 * Get the V-Pot LED ring value of a ring.
+		 * \param channel		Channel Number (1-8)
+		 * \return	V-Pot LED Ring Value (Message::toVPotLEDRingValue)
+		 */
+		int getRingValue(int channel) const;
+		/**
+		 * Convert a normalized value to a V-Pot LED ring value through the lookup table of the mode.
+		 * \param centerLEDOn	Center LED On/Off
+		 * \param mode			LED Ring Mode
+		 * \param value			Normalized Value (0-1)
+		 */
+		static int toRingValue(bool centerLEDOn, VPotLEDRingMode mode, float value);
+
+		/**
+		 * Check if any ring differs from the last-sent one.
+		 */
+		bool isDirty() const;
+		/**
+		 * Forget the sent rings, so the next update sends every ring.
+		 */
+		void invalidate();
+
+		/**
+		 * Append V-Pot LED ring messages of the changed rings to the MIDI buffer.
+		 * \param buffer		MIDI Buffer
+		 * \param samplePosition	Sample Position
+		 * \return	Count of bytes emitted
+		 */
+		int update(juce::MidiBuffer& buffer, int samplePosition = 0);
+		/**
+		 * Write V-Pot LED ring messages of the changed rings into the buffer as raw MIDI bytes.
+		 * Rings which don't fit into the buffer stay dirty for the next update.
+		 * \param dest			Destination Buffer
+		 * \return	Count of bytes written
+		 */
+		int update(std::span<uint8_t> dest);
+
+		/**
+		 * Get the count of bytes sent by this renderer.
+		 */
+		uint64_t getNumBytesSent() const;
+		/**
+		 * Get the count of bytes saved compared with sending every ring on each update.
+		 */
+		uint64_t getNumBytesSaved() const;
+
+	private:
+		std::array<VPotLEDRingMode, numRings> modes;
+		std::array<bool, numRings> centerLEDs;
+		std::array<float, numRings> values;
+		std::array<uint8_t, numRings> rings, sentRings;
+		uint64_t numBytesSent = 0, numBytesSaved = 0;
+
+		void render(int index);
+
+		template <typename Writer>
+		int updateTo(Writer&& writer);
+
+		JUCE_LEAK_DETECTOR(VPotRingRenderer)
+	};
+}
@@ -0,0 +1,88 @@
+/*****************************************************************//**
+ * \file	OutputSchedulerTest.cpp
+ * \brief	Standalone checks of OutputScheduler coalescing.
+ * 
+ * \author	libMackieControl contributors
+ * \date	Oct 2026
+ * \version	1.1.0
+ * \license	MIT License
+ * 
+ * Build this file with every .cpp file in src and JuceHeader.h on the include path,
+ * then run it. The exit code is non-zero if any check fails.
+ *********************************************************************/
+
+#include <cstdio>
+
+#include "../src/OutputScheduler.h"
+
+using namespace mackieControl;
+
+static int failures = 0;
+
+static void check(bool condition, const char* what) {
+	if (!condition) {
+		std::printf("FAILED: %s\n", what);
+		failures++;
+	}
+}
+
+/** A full time code followed by a partial update must send the upper digits of the first and the lower digits of the second. */
+static void testTimeCodeMerge() {
+	OutputScheduler scheduler;
+
+	const uint8_t fullDigits[10] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+	std::array<uint8_t, Message::getTimeCodeBBTDisplaySize(10)> full{};
+	int fullSize = Message::writeTimeCodeBBTDisplay(full, fullDigits, 10);
+	check(scheduler.push(MessageView{ full.data(), fullSize }), "push full time code");
+
+	const uint8_t partialDigits[2] = { 20, 21 };
+	std::array<uint8_t, Message::getTimeCodeBBTDisplaySize(2)> partial{};
+	int partialSize = Message::writeTimeCodeBBTDisplay(partial, partialDigits, 2);
+	check(scheduler.push(MessageView{ partial.data(), partialSize }), "push partial time code");
+	check(scheduler.getNumCoalesced() == 1, "partial time code coalesced");
+
+	juce::MidiBuffer buffer;
+	scheduler.process(0, buffer);
+
+	int numEvents = 0;
+	for (const auto metadata : buffer) {
+		numEvents++;
+		check(metadata.numBytes == fullSize, "merged time code keeps all digits");
+		if (metadata.numBytes != fullSize) { continue; }
+
+		const uint8_t expected[10] = { 20, 21, 3, 4, 5, 6, 7, 8, 9, 10 };
+		check(std::memcmp(&metadata.data[1 + 6], expected, sizeof(expected)) == 0, "merged time code digits");
+	}
+	check(numEvents == 1, "one time code message sent");
+}
+
+/** A full time code replaces a queued partial one. */
+static void testTimeCodeReplace() {
+	OutputScheduler scheduler;
+
+	const uint8_t partialDigits[2] = { 20, 21 };
+	std::array<uint8_t, Message::getTimeCodeBBTDisplaySize(2)> partial{};
+	int partialSize = Message::writeTimeCodeBBTDisplay(partial, partialDigits, 2);
+	scheduler.push(MessageView{ partial.data(), partialSize });
+
+	const uint8_t fullDigits[10] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+	std::array<uint8_t, Message::getTimeCodeBBTDisplaySize(10)> full{};
+	int fullSize = Message::writeTimeCodeBBTDisplay(full, fullDigits, 10);
+	scheduler.push(MessageView{ full.data(), fullSize });
+
+	juce::MidiBuffer buffer;
+	scheduler.process(0, buffer);
+
+	for (const auto metadata : buffer) {
+		check(metadata.numBytes == fullSize
+			&& std::memcmp(metadata.data, full.data(), fullSize) == 0, "full time code replaces partial");
+	}
+}
+
+int main() {
+	testTimeCodeMerge();
+	testTimeCodeReplace();
+
+	std::printf("%s\n", (failures == 0) ? "All tests passed" : "Some tests failed");
+	return (failures == 0) ? 0 : 1;
+}